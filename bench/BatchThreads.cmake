@@ -0,0 +1,69 @@
+# Plans a generated project with JunctionBatch on one thread and on eight and
+# checks that both runs write the same files, and that no terminal of a
+# schedule is listed twice.
+#
+# Run with cmake -DWORKBOOK_BENCHMARK=<path> -DJUNCTION_BATCH=<path> -DWORK_DIR=<dir> -P BatchThreads.cmake
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+# Junctions too large for the standard sizes land in the catalog enclosure
+file(WRITE ${WORK_DIR}/catalog.txt
+    "# name, capacity, origin x, origin y, flip\n"
+    "36x36x10, 96, 11.1875, 26.0750, 0\n"
+    "36x36x10, 96, 21.8125, 26.0750, 1\n"
+    "36x36x10, 96, 16.5000, 4.0000, 0\n")
+
+execute_process(COMMAND ${WORKBOOK_BENCHMARK} -o ${WORK_DIR}/project.xlsx 3000 RESULT_VARIABLE result)
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "WorkbookBenchmark failed to write the project")
+endif()
+
+foreach (threads 1 8)
+    execute_process(
+        COMMAND ${JUNCTION_BATCH} -j ${threads} -o ${WORK_DIR}/j${threads} -c ${WORK_DIR}/catalog.txt ${WORK_DIR}/project.xlsx
+        WORKING_DIRECTORY ${WORK_DIR}
+        RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "JunctionBatch -j ${threads} failed")
+    endif()
+endforeach()
+
+file(GLOB_RECURSE single RELATIVE ${WORK_DIR}/j1 ${WORK_DIR}/j1/*)
+file(GLOB_RECURSE parallel RELATIVE ${WORK_DIR}/j8 ${WORK_DIR}/j8/*)
+list(SORT single)
+list(SORT parallel)
+
+if (NOT single STREQUAL parallel)
+    message(FATAL_ERROR "JunctionBatch wrote different files on 1 and 8 threads")
+endif()
+
+set(schedules 0)
+foreach (name ${single})
+    execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${WORK_DIR}/j1/${name} ${WORK_DIR}/j8/${name} RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "${name} differs between 1 and 8 threads")
+    endif()
+
+    if (name MATCHES "\\.csv$")
+        math(EXPR schedules "${schedules} + 1")
+
+        # Each row starts with its junction, table and terminal
+        file(STRINGS ${WORK_DIR}/j1/${name} rows)
+        list(REMOVE_AT rows 0)
+        list(TRANSFORM rows REPLACE "^([^,]*,[^,]*,[^,]*),.*$" "\\1")
+        list(LENGTH rows count)
+        list(REMOVE_DUPLICATES rows)
+        list(LENGTH rows unique)
+
+        if (NOT count EQUAL unique)
+            message(FATAL_ERROR "${name} lists a terminal more than once")
+        endif()
+    endif()
+endforeach()
+
+if (schedules EQUAL 0)
+    message(FATAL_ERROR "JunctionBatch wrote no terminal schedules")
+endif()
+
+message(STATUS "JunctionBatch wrote the same ${schedules} schedules on 1 and 8 threads")
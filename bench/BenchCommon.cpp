@@ -0,0 +1,122 @@
+/**
+ * @file BenchCommon.cpp
+ * @brief Generators and block readers shared by the benchmarks.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "BenchCommon.h"
+
+#include <algorithm>
+
+#include "Drawing.h"
+
+// -----------------------------------------------------------------------------
+// Internal Constants
+// -----------------------------------------------------------------------------
+
+static const int _cablesPerBox = 24; ///< Cables of each generated junction box.
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+std::vector<Cable> generateCables(std::mt19937& rng, int count, const std::string& prefix, int maxDevices) {
+    static const CableType types[] = { CableType::PAIR1, CableType::PAIR1, CableType::PAIR1, CableType::PAIR2, CableType::PAIR4, CableType::TRIAD1, CableType::WIRE7 };
+    static const int footprints[] = { 3, 3, 4, 6 };
+
+    std::vector<Cable> cables;
+    cables.reserve(count);
+
+    for (int i = 0; i < count; ++i) {
+        // One draw per statement, so every compiler generates the same cables
+        CableType cableType = types[rng() % 7];
+        SystemType systemType = (rng() % 3 == 0) ? SystemType::SAFETY : SystemType::CONTROL;
+        IOType ioType = (rng() % 2) ? IOType::DIGITAL : IOType::ANALOG;
+        Cable cable(cableType, systemType, ioType);
+
+        int devices = 1 + rng() % maxDevices;
+        for (int d = 0; d < devices; ++d) {
+            cable.addDevice(Device("TT " + prefix + std::to_string(100 + i) + std::string(1, static_cast<char>('A' + d)), footprints[rng() % 4]));
+        }
+
+        cables.push_back(cable);
+    }
+
+    std::sort(cables.begin(), cables.end());
+
+    return cables;
+}
+
+DrawBuffer generateDrawing(int count, int maxDevices, const BoxPlanner& planBox, const BoxDrawn& drawn) {
+    std::mt19937 rng(20261016);
+    DrawBuffer buffer;
+
+    for (int box = 0; box * _cablesPerBox < count; ++box) {
+        std::vector<Cable> cables = generateCables(rng, std::min(_cablesPerBox, count - box * _cablesPerBox), std::to_string(box) + "-", maxDevices);
+        std::wstring junctionTag = L"IJB-" + std::to_wstring(100 + box);
+
+        LayoutPlan plan = planBox(box, cables);
+        drawJunctionBox(buffer, cables, plan, junctionTag);
+
+        if (drawn) drawn(box, junctionTag, cables, plan);
+    }
+
+    return buffer;
+}
+
+std::vector<ScanBlock> readScanBlocks(const DrawBuffer& buffer) {
+    std::vector<ScanBlock> blocks(buffer.getBlockCount());
+
+    for (const DrawCommand& command : buffer.getCommands()) {
+        if (command.op == DrawOp::INSERT_BLOCK) {
+            ScanBlock& block = blocks[command.block];
+            block.kind = getBlockKind(buffer.getString(command.name));
+            block.x = command.x;
+            block.y = command.y;
+        } else if (command.op == DrawOp::SET_ATTRIBUTE) {
+            blocks[command.block].attributes.emplace_back(buffer.getString(command.name), buffer.getString(command.text));
+        } else if (command.op == DrawOp::SET_PROPERTY && buffer.getString(command.name) == L"Visibility1") {
+            ScanBlock& block = blocks[command.block];
+            if (block.kind == BlockKind::JUNCTION_TERM || block.kind == BlockKind::JUNCTION_TERM7) block.visibility = buffer.getString(command.text);
+        }
+    }
+
+    return blocks;
+}
+
+std::vector<ReindexBlock> readReindexBlocks(const DrawBuffer& buffer) {
+    static const std::wstring fieldTag = L"FLDTAG";
+
+    std::vector<ReindexBlock> blocks(buffer.getBlockCount());
+
+    for (const DrawCommand& command : buffer.getCommands()) {
+        if (command.op == DrawOp::INSERT_BLOCK) {
+            ReindexBlock& block = blocks[command.block];
+            block.kind = getBlockKind(buffer.getString(command.name));
+            block.x = command.x;
+            block.y = command.y;
+        } else if (command.op == DrawOp::SET_ATTRIBUTE) {
+            const std::wstring& tag = buffer.getString(command.name);
+            if (tag.compare(0, fieldTag.size(), fieldTag) != 0) continue;
+
+            size_t n = std::stoul(tag.substr(fieldTag.size()));
+            std::vector<std::wstring>& fieldTags = blocks[command.block].fieldTags;
+            if (fieldTags.size() < n) fieldTags.resize(n);
+            fieldTags[n - 1] = buffer.getString(command.text);
+        }
+    }
+
+    return blocks;
+}
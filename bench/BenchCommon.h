@@ -0,0 +1,80 @@
+/**
+ * @file BenchCommon.h
+ * @brief Generators and block readers shared by the benchmarks.
+ *
+ * Every benchmark times its hot path with `secondsSince`, and the drawing
+ * benchmarks generate the same kind of cables and junction boxes and read
+ * the drawn blocks back the way the AutoCAD commands read them from model
+ * space. The generators draw from a fixed seed one value per statement, so
+ * every compiler generates the same cables.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Cable.h"
+#include "DrawBuffer.h"
+#include "LayoutPlanner.h"
+#include "TableReindex.h"
+#include "TerminalTable.h"
+
+using Clock = std::chrono::steady_clock;
+
+/// Plans the cables of a generated junction box, given its number.
+typedef std::function<LayoutPlan(int box, const std::vector<Cable>& cables)> BoxPlanner;
+
+/// Called after a generated junction box is drawn; may change its cables.
+typedef std::function<void(int box, const std::wstring& junctionTag, std::vector<Cable>& cables, const LayoutPlan& plan)> BoxDrawn;
+
+/**
+ * @brief Seconds elapsed since `start`.
+ */
+double secondsSince(Clock::time_point start);
+
+/**
+ * @brief Build `count` sorted cables of every cable type.
+ *
+ * Device tags are "TT <prefix><100 + i><A, B...>".
+ *
+ * @param rng        Random source, advanced past the cables.
+ * @param count      Number of cables.
+ * @param prefix     Prefix of the device tags.
+ * @param maxDevices Each cable gets one to `maxDevices` devices.
+ */
+std::vector<Cable> generateCables(std::mt19937& rng, int count, const std::string& prefix = "", int maxDevices = 2);
+
+/**
+ * @brief Draw `count` generated cables as junction boxes of 24 cables.
+ *
+ * Box n is tagged IJB-<100 + n> and its device tags are prefixed "<n>-".
+ *
+ * @param count      Number of cables.
+ * @param maxDevices Each cable gets one to `maxDevices` devices.
+ * @param planBox    Plans each box.
+ * @param drawn      Called after each box is drawn; may be empty.
+ */
+DrawBuffer generateDrawing(int count, int maxDevices, const BoxPlanner& planBox, const BoxDrawn& drawn = BoxDrawn());
+
+/**
+ * @brief Read the blocks of a drawing the way EXPORTTERMINALS and VERIFYDRAWING do.
+ */
+std::vector<ScanBlock> readScanBlocks(const DrawBuffer& buffer);
+
+/**
+ * @brief Read the blocks of a drawing the way REINDEXALL does.
+ */
+std::vector<ReindexBlock> readReindexBlocks(const DrawBuffer& buffer);
@@ -0,0 +1,260 @@
+/**
+ * @file DrawBenchmark.cpp
+ * @brief Benchmark of recording and playing the draw commands of large boxes.
+ *
+ * Draws generated junction boxes into a DrawBuffer and plays them into a
+ * RecordingBackend, without AutoCAD. Besides the timings, a digest of each
+ * box's transcript is printed. The cables are generated from a fixed seed, so
+ * a change to the drawing logic that alters any block, attribute, property,
+ * layer, scale or position changes the digest, and the benchmark fails if
+ * the digest of a default size differs from the one checked in below.
+ *
+ * Before timing, a few blocks are written as DXF with the attribute
+ * definitions of a minimal block library, and every ATTRIB must land on its
+ * definition's point with its justification and flags, mirrored with a
+ * flipped TBWIREMINI.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "Cable.h"
+#include "DrawBuffer.h"
+#include "Drawing.h"
+#include "DxfBackend.h"
+#include "LayoutPlanner.h"
+#include "RecordingBackend.h"
+
+// -----------------------------------------------------------------------------
+// Internal Constants
+// -----------------------------------------------------------------------------
+
+/// Transcript digests of the generated boxes, by cable count. A change meant
+/// to alter the drawing must update them.
+static const std::map<int, std::uint64_t> _expectedDigests = {
+    { 48, 0x0430abd7e114ead2ull },
+    { 1000, 0x79dd9c19bef86769ull },
+    { 10000, 0x911a7811ea2c73d3ull }
+};
+
+/// Block library with a right, middle justified terminal number on a
+/// TBWIREMINI whose base point is not the origin, and a left baseline tag and
+/// a hidden, centered number on INST SYMBOL.
+static const char* const _blockLibrary =
+    "0\nSECTION\n2\nBLOCKS\n"
+    "0\nBLOCK\n2\nTBWIREMINI\n10\n1.0\n20\n2.0\n"
+    "0\nATTDEF\n10\n0.5\n20\n1.96\n11\n0.75\n21\n2.0\n40\n0.08\n2\n#\n70\n0\n72\n2\n74\n2\n"
+    "0\nENDBLK\n"
+    "0\nBLOCK\n2\nINST SYMBOL\n10\n0.0\n20\n0.0\n"
+    "0\nATTDEF\n10\n0.1\n20\n0.3\n40\n0.1\n2\nTAG\n70\n0\n"
+    "0\nATTDEF\n10\n-0.2\n20\n-0.2\n11\n0.0\n21\n-0.2\n40\n0.1\n2\nNUMBER\n70\n1\n72\n1\n"
+    "0\nENDBLK\n"
+    "0\nENDSEC\n0\nEOF\n";
+
+// -----------------------------------------------------------------------------
+// Internal Types
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief An ATTRIB the DXF file must contain.
+ */
+struct _ExpectedAttribute {
+    std::string tag;     ///< Tag of the attribute.
+    std::string value;   ///< Text of the attribute.
+    double x;            ///< X of the text point.
+    double y;            ///< Y of the text point.
+    bool aligned;        ///< true if the alignment point is written, at the text point.
+    int horizontal;      ///< Horizontal justification.
+    int vertical;        ///< Vertical justification.
+    int flags;           ///< Attribute flags.
+};
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief FNV-1a hash of a transcript.
+ */
+static std::uint64_t _digest(const std::string& text) {
+    std::uint64_t hash = 1469598103934665603ull;
+    for (unsigned char c : text) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/**
+ * @brief A numeric group of a DXF entity, or `missing` if it has none.
+ */
+static double _groupNumber(const std::map<int, std::string>& groups, int code, double missing) {
+    auto it = groups.find(code);
+    return it == groups.end() ? missing : std::strtod(it->second.c_str(), nullptr);
+}
+
+/**
+ * @brief Write a few blocks as DXF and check where their attributes land.
+ *
+ * @return An empty string if every ATTRIB is placed as expected, the error otherwise.
+ */
+static std::string _checkDxf() {
+    std::istringstream library(_blockLibrary);
+    DxfBlockTemplates templates = readDxfBlockTemplates(library);
+
+    DrawBuffer buffer;
+
+    std::uint32_t term = buffer.insertBlock(L"TBWIREMINI", { 10.0, 5.0 });
+    buffer.setAttribute(term, L"#", L"+");
+    buffer.setScale(term, 1.0, 1.0, 1.0);
+
+    std::uint32_t mirrored = buffer.insertBlock(L"TBWIREMINI", { 20.0, 5.0 });
+    buffer.setAttribute(mirrored, L"#", L"-");
+    buffer.setScale(mirrored, -1.0, 1.0, 1.0);
+
+    std::uint32_t symbol = buffer.insertBlock(L"INST SYMBOL", { 30.0, 5.0 });
+    buffer.setAttribute(symbol, L"TAG", L"TT");
+    buffer.setAttribute(symbol, L"NUMBER", L"101");
+    buffer.setAttribute(symbol, L"LOOP", L"1"); // No definition, so not written
+
+    std::ostringstream out;
+    DxfBackend backend(out, getDrawingBlockNames(), templates);
+    backend.execute(buffer);
+    backend.finish();
+
+    // The mirrored terminal number hangs from the other side and swaps right for left
+    const std::vector<_ExpectedAttribute> expected = {
+        { "#", "+", 9.75, 5.0, true, 2, 2, 0 },
+        { "#", "-", 20.25, 5.0, true, 0, 2, 0 },
+        { "TAG", "TT", 30.1, 5.3, false, 0, 0, 0 },
+        { "NUMBER", "101", 30.0, 4.8, true, 1, 0, 1 }
+    };
+
+    // The groups of every ATTRIB, in order
+    std::vector<std::map<int, std::string>> attributes;
+    std::map<int, std::string>* pAttribute = nullptr;
+
+    std::istringstream in(out.str());
+    std::string code;
+    std::string value;
+    while (std::getline(in, code) && std::getline(in, value)) {
+        if (code == "0") {
+            pAttribute = nullptr;
+            if (value == "ATTRIB") {
+                attributes.emplace_back();
+                pAttribute = &attributes.back();
+            }
+        } else if (pAttribute) {
+            (*pAttribute)[std::stoi(code)] = value;
+        }
+    }
+
+    if (attributes.size() != expected.size()) {
+        return "wrote " + std::to_string(attributes.size()) + " attributes instead of " + std::to_string(expected.size());
+    }
+
+    for (size_t i = 0; i < expected.size(); ++i) {
+        const std::map<int, std::string>& groups = attributes[i];
+        const _ExpectedAttribute& attribute = expected[i];
+        std::string name = attribute.tag + " " + attribute.value;
+
+        if (groups.count(2) == 0 || groups.at(2) != attribute.tag || groups.count(1) == 0 || groups.at(1) != attribute.value) {
+            return "attribute " + std::to_string(i) + " is not " + name;
+        }
+
+        double x = _groupNumber(groups, 10, NAN);
+        double y = _groupNumber(groups, 20, NAN);
+        if (!(std::abs(x - attribute.x) < 1e-9 && std::abs(y - attribute.y) < 1e-9)) {
+            return name + " is placed at " + groups.at(10) + ", " + groups.at(20);
+        }
+
+        bool aligned = groups.count(11) != 0 && groups.count(21) != 0;
+        if (aligned != attribute.aligned || (aligned && (_groupNumber(groups, 11, NAN) != x || _groupNumber(groups, 21, NAN) != y))) {
+            return name + " has the wrong alignment point";
+        }
+
+        if (_groupNumber(groups, 72, 0.0) != attribute.horizontal || _groupNumber(groups, 74, 0.0) != attribute.vertical) {
+            return name + " has the wrong justification";
+        }
+
+        if (_groupNumber(groups, 70, NAN) != attribute.flags) {
+            return name + " has the wrong flags";
+        }
+    }
+
+    return std::string();
+}
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    std::vector<int> sizes = { 48, 1000, 10000 };
+    if (argc > 1) {
+        sizes.clear();
+        for (int i = 1; i < argc; ++i) sizes.push_back(std::stoi(argv[i]));
+    }
+
+    std::string dxfError = _checkDxf();
+    if (!dxfError.empty()) {
+        std::fprintf(stderr, "DXF attributes: %s\n", dxfError.c_str());
+        return 1;
+    }
+
+    std::printf("%10s %10s %10s %14s %14s %18s\n", "cables", "blocks", "commands", "record (s)", "play (s)", "digest");
+
+    for (int count : sizes) {
+        std::mt19937 rng(20261016);
+        std::vector<Cable> cables = generateCables(rng, count);
+
+        // A custom box holds any number of cables on one table
+        LayoutPlan plan = LayoutPlanner(BoxSize::CUSTOM).plan(cables);
+
+        Clock::time_point start = Clock::now();
+        DrawBuffer buffer;
+        drawJunctionBox(buffer, cables, plan, L"IJB-810");
+        double recordSeconds = secondsSince(start);
+
+        start = Clock::now();
+        RecordingBackend counter;
+        counter.execute(buffer);
+        double playSeconds = secondsSince(start);
+
+        std::ostringstream transcript;
+        RecordingBackend recorder(transcript);
+        recorder.execute(buffer);
+
+        std::uint64_t digest = _digest(transcript.str());
+
+        std::printf("%10d %10u %10zu %14.6f %14.6f %18llx\n",
+            count, buffer.getBlockCount(), buffer.getCommands().size(), recordSeconds, playSeconds,
+            static_cast<unsigned long long>(digest));
+
+        auto expected = _expectedDigests.find(count);
+        if (expected != _expectedDigests.end() && expected->second != digest) {
+            std::fprintf(stderr, "Drawing of %d cables differs from the checked in digest %llx\n",
+                count, static_cast<unsigned long long>(expected->second));
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,49 @@
+# Writes a generated project with JunctionDxf without a block library, which
+# must warn that no attributes are written, and with one, which must not.
+#
+# Run with cmake -DWORKBOOK_BENCHMARK=<path> -DJUNCTION_DXF=<path> -DWORK_DIR=<dir> -P DxfBlockLibrary.cmake
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+# One terminal number definition is enough to place attributes
+file(WRITE ${WORK_DIR}/blocks.dxf
+    "0\nSECTION\n2\nBLOCKS\n"
+    "0\nBLOCK\n2\nTBWIREMINI\n10\n0.0\n20\n0.0\n"
+    "0\nATTDEF\n10\n0.1\n20\n0.0\n40\n0.08\n2\n#\n70\n0\n"
+    "0\nENDBLK\n"
+    "0\nENDSEC\n0\nEOF\n")
+
+execute_process(COMMAND ${WORKBOOK_BENCHMARK} -o ${WORK_DIR}/project.xlsx 200 RESULT_VARIABLE result OUTPUT_QUIET)
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "WorkbookBenchmark failed to write the project")
+endif()
+
+execute_process(
+    COMMAND ${JUNCTION_DXF} ${WORK_DIR}/project.xlsx ${WORK_DIR}/bare.dxf
+    RESULT_VARIABLE result
+    ERROR_VARIABLE errors)
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "JunctionDxf without -b failed:\n${errors}")
+endif()
+if (NOT errors MATCHES "Warning: no block library")
+    message(FATAL_ERROR "JunctionDxf without -b did not warn that no attributes are written")
+endif()
+
+execute_process(
+    COMMAND ${JUNCTION_DXF} -b ${WORK_DIR}/blocks.dxf ${WORK_DIR}/project.xlsx ${WORK_DIR}/attributes.dxf
+    RESULT_VARIABLE result
+    ERROR_VARIABLE errors)
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "JunctionDxf -b failed:\n${errors}")
+endif()
+if (errors MATCHES "Warning")
+    message(FATAL_ERROR "JunctionDxf -b warned:\n${errors}")
+endif()
+
+file(READ ${WORK_DIR}/attributes.dxf text)
+if (NOT text MATCHES "\nATTRIB\n")
+    message(FATAL_ERROR "JunctionDxf -b wrote no attributes")
+endif()
+
+message(STATUS "JunctionDxf warns only without a block library")
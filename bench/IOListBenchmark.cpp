@@ -0,0 +1,158 @@
+/**
+ * @file IOListBenchmark.cpp
+ * @brief Benchmark of IO List device lookups on generated workbooks.
+ *
+ * Compares the row-by-row IO List scan that used to run for every Cable
+ * Schedule row against the hash-indexed IOList.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "OpenXLSX.hpp"
+
+#include "BenchCommon.h"
+#include "IOList.h"
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Combined tag of the n-th generated device (e.g. "TT 42").
+ */
+static std::string _deviceTag(int n) {
+    static const char* prefixes[] = { "TT", "PT", "LSLL", "FT", "ZSC", "SDV" };
+    return std::string(prefixes[n % 6]) + " " + std::to_string(n);
+}
+
+/**
+ * @brief Write a workbook with `rows` devices in both the Cable Schedule and the IO List.
+ */
+static void _generateWorkbook(const std::string& filename, int rows) {
+    OpenXLSX::XLDocument doc;
+    doc.create(filename);
+
+    doc.workbook().addWorksheet("Cable Schedule Data");
+    doc.workbook().addWorksheet("IO List");
+
+    OpenXLSX::XLWorksheet cableWks = doc.workbook().worksheet("Cable Schedule Data");
+    OpenXLSX::XLWorksheet ioWks = doc.workbook().worksheet("IO List");
+
+    for (int i = 0; i < rows; ++i) {
+        std::string tag = _deviceTag(i);
+
+        cableWks.cell(3 + i, 1).value() = "1 Pair";
+        cableWks.cell(3 + i, 3).value() = "IJB-" + std::to_string(800 + i % 60);
+        cableWks.cell(3 + i, 4).value() = tag;
+
+        // Reverse the IO List so lookups land all over the sheet
+        int ioRow = 7 + (rows - 1 - i);
+        ioWks.cell(ioRow, 2).value() = tag;
+        ioWks.cell(ioRow, 5).value() = (i % 10 == 0) ? "RTD" : "PRESSURE";
+        ioWks.cell(ioRow, 7).value() = (i % 2 == 0) ? "AI" : "DI";
+        ioWks.cell(ioRow, 8).value() = (i % 3 == 0) ? "Safety" : "Control";
+    }
+
+    doc.save();
+    doc.close();
+}
+
+/**
+ * @brief The original lookup: scan the IO List from the top for every device.
+ */
+static bool _scanLookup(OpenXLSX::XLWorksheet& ioWks, const std::string& combinedTag, IOListEntry& entry) {
+    for (int row = 7; ioWks.cell(row, 2).value() != ""; ++row) {
+        if (ioWks.cell(row, 2).value() == combinedTag) {
+            entry.instrumentSpec = ioWks.cell(row, 5).value().getString();
+            entry.ioType = ioWks.cell(row, 7).value().getString();
+            entry.systemType = ioWks.cell(row, 8).value().getString();
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Read the IO List into an index through OpenXLSX.
+ */
+static IOList _indexWorksheet(OpenXLSX::XLWorksheet& ioWks) {
+    IOList ioList;
+
+    for (int row = 7; ioWks.cell(row, 2).value() != ""; ++row) {
+        IOListEntry entry;
+        entry.instrumentSpec = ioWks.cell(row, 5).value().getString();
+        entry.ioType = ioWks.cell(row, 7).value().getString();
+        entry.systemType = ioWks.cell(row, 8).value().getString();
+
+        ioList.add(ioWks.cell(row, 2).value().getString(), std::move(entry));
+    }
+
+    return ioList;
+}
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    std::vector<int> sizes = { 1000, 10000, 100000 };
+    if (argc > 1) {
+        sizes.clear();
+        for (int i = 1; i < argc; ++i) sizes.push_back(std::stoi(argv[i]));
+    }
+
+    // The scan is quadratic, so it is timed on a sample of lookups and extrapolated
+    const int scanSamples = 50;
+
+    std::printf("%10s %14s %14s %14s %10s\n", "rows", "scan (s)", "index (s)", "lookups/s", "speedup");
+
+    for (int rows : sizes) {
+        std::string filename = "iolist_bench_" + std::to_string(rows) + ".xlsx";
+        _generateWorkbook(filename, rows);
+
+        OpenXLSX::XLDocument doc;
+        doc.open(filename);
+        OpenXLSX::XLWorksheet ioWks = doc.workbook().worksheet("IO List");
+
+        // Scan every device in the sheet (sampled)
+        int samples = rows < scanSamples ? rows : scanSamples;
+        IOListEntry entry;
+        Clock::time_point start = Clock::now();
+        for (int s = 0; s < samples; ++s) {
+            _scanLookup(ioWks, _deviceTag(s * (rows / samples)), entry);
+        }
+        double scanSeconds = secondsSince(start) / samples * rows;
+
+        // Index once, then look up every device
+        start = Clock::now();
+        IOList ioList = _indexWorksheet(ioWks);
+        int found = 0;
+        for (int i = 0; i < rows; ++i) {
+            if (ioList.find(_deviceTag(i))) found++;
+        }
+        double indexSeconds = secondsSince(start);
+
+        doc.close();
+
+        if (found != rows) {
+            std::fprintf(stderr, "Index resolved %d of %d devices\n", found, rows);
+            return 1;
+        }
+
+        std::printf("%10d %14.3f %14.3f %14.0f %9.1fx\n",
+            rows, scanSeconds, indexSeconds, rows / indexSeconds, scanSeconds / indexSeconds);
+    }
+
+    return 0;
+}
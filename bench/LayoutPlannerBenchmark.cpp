@@ -0,0 +1,386 @@
+/**
+ * @file LayoutPlannerBenchmark.cpp
+ * @brief Benchmark of table layout planning on generated cable lists.
+ *
+ * Compares the original per-cable split check, which re-sums the footprint of
+ * every remaining cable, against LayoutPlanner, and checks that both place
+ * every cable on the same table and terminal. The spare counts FitEvaluator
+ * reports for the size selector are checked against the original
+ * per-size calculation on randomly generated junctions, for both the
+ * constexpr standard sizes and the same sizes loaded from a catalog. The
+ * catalog parser is checked on a three-table enclosure and on malformed and
+ * duplicate lines.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "BoxCatalog.h"
+#include "Cable.h"
+#include "LayoutPlanner.h"
+
+// -----------------------------------------------------------------------------
+// Internal Constants
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief The standard sizes and a three-table enclosure, as a catalog file lists them.
+ */
+static const char* const _catalogText =
+    "# name, capacity, origin x, origin y, flip\n"
+    "12x12x6, 24, 19.3750, 12.4977, 0\n"
+    "\n"
+    "16x16x6, 42, 19.3750, 14.7500, 0\n"
+    "24x24x8, 72, 11.1875, 18.3250, 0\n"
+    "  36x36x10 ,96, 11.1875, 26.0750, 0\r\n"
+    "24x24x8, 72, 21.8125, 18.3250, 1\n"
+    "36x36x10, 96, 21.8125, 26.0750, 1\n"
+    "36x36x10, 24, 16.5000, 4.0000, 0\n";
+
+/**
+ * @brief Catalog lines that must be rejected, each after one good line.
+ */
+static const char* const _badCatalogLines[] = {
+    "36x36x10, 96, 11.1875",                // Too few fields
+    "36x36x10, 96, 11.1875, 26.0750, 0, 1", // Too many fields
+    "36x36x10, 96, 11.1875, 26.0750,",      // Empty flip
+    ", 96, 11.1875, 26.0750, 0",            // No name
+    "36x36x10, 96x, 11.1875, 26.0750, 0",   // Trailing text
+    "36x36x10, 0, 11.1875, 26.0750, 0",     // No terminals
+    "36x36x10, 9.5, 11.1875, 26.0750, 0",   // Part of a terminal
+    "36x36x10, 96, nan, 26.0750, 0",        // Not a coordinate
+    "36x36x10, 96, 11.1875, 26.0750, 2",    // Not a flip
+    "12x12x6, 24, 19.375, 12.4977, 1",      // Same table as the good line
+};
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief The original split check, summing the rest of the cables every call.
+ */
+static bool _legacyShouldSplit(const std::vector<Cable>& cables, int currentCableIndex, int currentTerminalIndex, int currentTableIndex) {
+    int sizeOfRest = 0;
+    for (int j = currentCableIndex; j < static_cast<int>(cables.size()); j++) {
+        sizeOfRest += cables[j].getTerminalFootprint();
+    }
+
+    if (sizeOfRest <= 72 && currentCableIndex != 0 && currentTableIndex == 1) {
+        if (cables[currentCableIndex].getSystemType() == SystemType::SAFETY && cables[currentCableIndex - 1].getSystemType() == SystemType::CONTROL) {
+            return true;
+        }
+
+        if (currentTerminalIndex + cables[currentCableIndex].getTerminalFootprint() - 1 > 72) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Place every cable of a LARGE box the original way.
+ *
+ * @return The table and terminal of every cable, packed as table * 1000000 + terminal.
+ */
+static std::vector<int> _legacyPlan(const std::vector<Cable>& cables) {
+    std::vector<int> placements;
+    placements.reserve(cables.size());
+
+    int terminal = 1;
+    int table = 1;
+    for (int i = 0; i < static_cast<int>(cables.size()); ++i) {
+        if (_legacyShouldSplit(cables, i, terminal, table)) {
+            terminal = 1;
+            table ++;
+        }
+
+        placements.push_back(table * 1000000 + terminal);
+        terminal += cables[i].getTerminalFootprint();
+    }
+
+    return placements;
+}
+
+/**
+ * @brief The original spare count shown by the size selector for one box size.
+ */
+static int _legacySpare(const std::vector<Cable>& cables, BoxSize boxSize) {
+    static const int capacities[] = { 24, 42, 144 };
+
+    int footprint = 0;
+    int terminal = 1;
+    int table = 1;
+    for (int i = 0; i < static_cast<int>(cables.size()); ++i) {
+        if (boxSize == BoxSize::LARGE && _legacyShouldSplit(cables, i, terminal, table)) {
+            terminal = 1;
+            table ++;
+        }
+
+        terminal += cables[i].getTerminalFootprint();
+        footprint += cables[i].getTerminalFootprint();
+
+        if (boxSize == BoxSize::LARGE && terminal > 72) {
+            footprint = std::numeric_limits<int>::max();
+            break;
+        }
+    }
+
+    return capacities[boxSize] - footprint;
+}
+
+/**
+ * @brief Whether the original LARGE check rejected the cables only because a table was filled to terminal 72.
+ *
+ * This is the one intended difference from the original: a full LARGE table
+ * now fits, as a full SMALL or MEDIUM table always did.
+ */
+static bool _fillsLargeTable(const std::vector<Cable>& cables) {
+    int terminal = 1;
+    int table = 1;
+    for (int i = 0; i < static_cast<int>(cables.size()); ++i) {
+        if (_legacyShouldSplit(cables, i, terminal, table)) {
+            terminal = 1;
+            table ++;
+        }
+
+        terminal += cables[i].getTerminalFootprint();
+        if (terminal > 72) return terminal == 73;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Build a junction of up to 60 cables in sheet (unsorted) order.
+ */
+static std::vector<Cable> _randomJunction(std::mt19937& rng) {
+    static const int footprints[] = { 3, 3, 3, 4, 6 };
+
+    std::vector<Cable> cables;
+    int count = 1 + rng() % 60;
+    for (int i = 0; i < count; ++i) {
+        Cable cable(CableType::PAIR1, (rng() % 2) ? SystemType::SAFETY : SystemType::CONTROL, (rng() % 2) ? IOType::DIGITAL : IOType::ANALOG);
+
+        int devices = 1 + rng() % 3;
+        for (int d = 0; d < devices; ++d) {
+            cable.addDevice(Device("TT " + std::to_string(rng() % 1000), footprints[rng() % 5]));
+        }
+
+        cables.push_back(cable);
+    }
+
+    return cables;
+}
+
+/**
+ * @brief Check FitEvaluator against the original spare counts.
+ *
+ * @return The number of junctions whose spare counts differ.
+ */
+static int _checkFits(int junctions, const std::vector<Enclosure>& enclosures, int& fullTables) {
+    std::mt19937 rng(20261016);
+    int mismatches = 0;
+    fullTables = 0;
+
+    for (int j = 0; j < junctions; ++j) {
+        std::vector<Cable> cables = _randomJunction(rng);
+        if (j % 2 == 0) std::sort(cables.begin(), cables.end());
+
+        std::vector<BoxFit> fits = FitEvaluator::evaluate(cables);
+        std::vector<BoxFit> enclosureFits = FitEvaluator::evaluate(cables, enclosures);
+
+        for (BoxSize boxSize : { BoxSize::SMALL, BoxSize::MEDIUM, BoxSize::LARGE }) {
+            int legacy = _legacySpare(cables, boxSize);
+            int spare = fits[boxSize].spare;
+
+            // The original reported an overflowing LARGE box as a huge negative count
+            bool same = (legacy < 0) ? (spare < 0 && (spare == legacy || boxSize == BoxSize::LARGE)) : (spare == legacy);
+            if (!same && boxSize == BoxSize::LARGE && legacy < 0 && _fillsLargeTable(cables)) {
+                if (spare != fits[boxSize].capacity - fits[boxSize].footprint) mismatches++;
+                fullTables++;
+                same = true;
+            }
+            if (!same) mismatches++;
+
+            // Run-time enclosures must plan exactly like the constexpr ones
+            if (enclosureFits[boxSize].spare != spare || enclosureFits[boxSize].tableFill != fits[boxSize].tableFill) mismatches++;
+        }
+
+        // The evaluator and the planner must fill the tables of the larger
+        // enclosures alike
+        for (size_t e = 3; e < enclosures.size(); ++e) {
+            LayoutPlan plan = LayoutPlanner(enclosures[e]).plan(cables);
+
+            std::vector<int> tableFill(enclosures[e].tables.size(), 0);
+            for (size_t i = 0; i < cables.size(); ++i) tableFill[plan[i].table - 1] += cables[i].getTerminalFootprint();
+
+            if (tableFill != enclosureFits[e].tableFill || plan.getOverflowIndex() != enclosureFits[e].overflowIndex) mismatches++;
+        }
+    }
+
+    return mismatches;
+}
+
+/**
+ * @brief Check that a LARGE table filled to its last terminal fits.
+ *
+ * The original rejected it. Twenty-four control cables of three terminals
+ * fill the first table exactly and never split onto the second.
+ *
+ * @return True if the original rejects the cables and FitEvaluator accepts them.
+ */
+static bool _checkFullLargeTable() {
+    std::vector<Cable> cables;
+    for (int i = 0; i < 24; ++i) {
+        Cable cable(CableType::PAIR1, SystemType::CONTROL, IOType::ANALOG);
+        cable.addDevice(Device("TT " + std::to_string(i), 3));
+        cables.push_back(cable);
+    }
+
+    BoxFit fit = FitEvaluator::evaluate(cables)[BoxSize::LARGE];
+    bool fullTable = !fit.tableFill.empty() && fit.tableFill[0] == 72;
+
+    return _legacySpare(cables, BoxSize::LARGE) < 0 && _fillsLargeTable(cables)
+        && fullTable && fit.overflowIndex < 0 && fit.spare == 72;
+}
+
+/**
+ * @brief Parse the test catalog and check the lines it must reject.
+ *
+ * @param enclosures Receives the enclosures of `_catalogText`.
+ * @return           A description of the first problem, or an empty string.
+ */
+static std::string _checkCatalog(std::vector<Enclosure>& enclosures) {
+    std::istringstream text(_catalogText);
+    enclosures = BoxCatalog::parse(text).getEnclosures();
+
+    // Tables are grouped by name, in the order the names first appear
+    if (enclosures.size() != 4) return "expected 4 enclosures, found " + std::to_string(enclosures.size());
+    if (enclosures[0].name != SMALL_BOX.name || enclosures[1].name != MEDIUM_BOX.name || enclosures[2].name != LARGE_BOX.name || enclosures[3].name != "36x36x10") {
+        return "enclosures are out of order";
+    }
+
+    for (size_t e = 0; e < 3; ++e) {
+        const TableSpec* expected = (e == 0) ? SMALL_BOX.tables.data() : (e == 1) ? MEDIUM_BOX.tables.data() : LARGE_BOX.tables.data();
+        if (enclosures[e].tables.size() != (e == 2 ? 2u : 1u)) return enclosures[e].name + " has the wrong number of tables";
+
+        for (size_t t = 0; t < enclosures[e].tables.size(); ++t) {
+            const TableSpec& table = enclosures[e].tables[t];
+            if (table.capacity != expected[t].capacity || table.originX != expected[t].originX ||
+                table.originY != expected[t].originY || table.flip != expected[t].flip) {
+                return enclosures[e].name + " table " + std::to_string(t + 1) + " differs from the standard size";
+            }
+        }
+    }
+
+    const Enclosure& wide = enclosures[3];
+    if (wide.tables.size() != 3 || wide.getCapacity() != 216 || !wide.tables[1].flip || wide.tables[2].capacity != 24) {
+        return "36x36x10 was not read as three tables";
+    }
+
+    std::istringstream again(_catalogText);
+    BoxCatalog catalog = BoxCatalog::parse(again);
+    if (catalog.find("36x36x10") == nullptr || catalog.find("36x36") != nullptr) return "find does not match whole names";
+
+    for (const char* line : _badCatalogLines) {
+        std::istringstream bad(std::string("12x12x6, 24, 19.3750, 12.4977, 0\n") + line + "\n");
+        try {
+            BoxCatalog::parse(bad);
+        } catch (const std::runtime_error& e) {
+            if (std::string(e.what()).find("line 2:") != std::string::npos) continue;
+            return std::string("wrong error for \"") + line + "\": " + e.what();
+        }
+        return std::string("accepted \"") + line + "\"";
+    }
+
+    return "";
+}
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    std::vector<int> sizes = { 48, 1000, 10000 };
+    if (argc > 1) {
+        sizes.clear();
+        for (int i = 1; i < argc; ++i) sizes.push_back(std::stoi(argv[i]));
+    }
+
+    if (!_checkFullLargeTable()) {
+        std::fprintf(stderr, "A LARGE table filled to terminal 72 does not fit\n");
+        return 1;
+    }
+
+    std::vector<Enclosure> enclosures;
+    std::string catalogError = _checkCatalog(enclosures);
+    if (!catalogError.empty()) {
+        std::fprintf(stderr, "Enclosure catalog: %s\n", catalogError.c_str());
+        return 1;
+    }
+
+    const int fitJunctions = 20000;
+    int fullTables = 0;
+    int mismatches = _checkFits(fitJunctions, enclosures, fullTables);
+    if (mismatches != 0) {
+        std::fprintf(stderr, "FitEvaluator differs from the original spare counts %d times\n", mismatches);
+        return 1;
+    }
+    std::printf("FitEvaluator matches the original spare counts on %d junctions (%d full LARGE tables now fit)\n\n", fitJunctions, fullTables);
+
+    std::printf("%10s %14s %14s %10s %14s %14s\n", "cables", "legacy (s)", "planner (s)", "speedup", "3 sizes (s)", "fit (s)");
+
+    for (int count : sizes) {
+        std::mt19937 rng(20261016);
+        std::vector<Cable> cables = generateCables(rng, count);
+
+        Clock::time_point start = Clock::now();
+        std::vector<int> legacy = _legacyPlan(cables);
+        double legacySeconds = secondsSince(start);
+
+        start = Clock::now();
+        LayoutPlan plan = LayoutPlanner(BoxSize::LARGE).plan(cables);
+        double plannerSeconds = secondsSince(start);
+
+        for (size_t i = 0; i < cables.size(); ++i) {
+            if (legacy[i] != plan[i].table * 1000000 + plan[i].terminal) {
+                std::fprintf(stderr, "Cable %zu placed differently with %d cables\n", i, count);
+                return 1;
+            }
+        }
+
+        // Size selector: three separate footprint passes against one fit evaluation
+        start = Clock::now();
+        for (BoxSize boxSize : { BoxSize::SMALL, BoxSize::MEDIUM, BoxSize::LARGE }) {
+            _legacySpare(cables, boxSize);
+        }
+        double sizesSeconds = secondsSince(start);
+
+        start = Clock::now();
+        std::vector<BoxFit> fits = FitEvaluator::evaluate(cables);
+        double fitSeconds = secondsSince(start);
+
+        std::printf("%10d %14.6f %14.6f %9.1fx %14.6f %14.6f\n",
+            count, legacySeconds, plannerSeconds, legacySeconds / plannerSeconds, sizesSeconds, fitSeconds);
+    }
+
+    return 0;
+}
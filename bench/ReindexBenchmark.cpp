@@ -0,0 +1,264 @@
+/**
+ * @file ReindexBenchmark.cpp
+ * @brief Benchmark of renumbering every terminal table of large drawings.
+ *
+ * Draws generated junction boxes into a DrawBuffer and reads the blocks back
+ * the way REINDEXALL reads them from model space. Boxes that fit a large box
+ * are drawn on its two tables, so many boxes share the same columns and only
+ * differ by prefix; the rest are custom boxes side by side.
+ *
+ * Each drawing is renumbered twice: once as drawn, which must not change any
+ * field tag, and once with every terminal number made stale, which must
+ * change every one. The moved terminations are then renumbered the way
+ * AUTOREINDEX does. Moving the bottom cable of every table four terminals
+ * down, or only its junction termination, must land both its terminations
+ * four terminals further. Moving only its field device termination, or the
+ * whole drawing, must not change any field tag.
+ *
+ * The record kept for every drawn cable must also read back unchanged after
+ * packing, as must records with an empty junction tag and the largest table
+ * and terminal numbers.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include <climits>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "Cable.h"
+#include "CableRecord.h"
+#include "DrawBuffer.h"
+#include "Drawing.h"
+#include "LayoutPlanner.h"
+#include "TableReindex.h"
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Pack a record and read it back.
+ *
+ * @return true if every packed field reads back unchanged.
+ */
+static bool _roundTrips(const CableRecord& record) {
+    PackedCableRecord data = packCableRecord(record);
+
+    CableRecord unpacked;
+    if (!unpackCableRecord(data.data(), data.size(), unpacked)) return false;
+
+    return unpacked.table == record.table && unpacked.firstTerminal == record.firstTerminal
+        && unpacked.lastTerminal == record.lastTerminal && unpacked.cableType == record.cableType;
+}
+
+/**
+ * @brief Check the packed layout of cable records on edge cases.
+ *
+ * @return An empty string if every record reads back, the error otherwise.
+ */
+static std::string _checkCableRecords() {
+    std::vector<CableRecord> records = {
+        { L"", 0, 0, 0, CableType::PAIR1 },
+        { L"", 65535, INT_MAX, INT_MAX, CableType::WIRE7 },
+        { L"IJB-810", 65535, 1, INT_MAX, CableType::PAIR4 },
+        { L"IJB-810", 1, -1, -1, CableType::TRIAD1 }
+    };
+    for (CableType cableType : { CableType::PAIR1, CableType::PAIR2, CableType::PAIR4, CableType::TRIAD1, CableType::WIRE7 }) {
+        records.push_back({ L"IJB-810", 2, 73, 78, cableType });
+    }
+
+    for (const CableRecord& record : records) {
+        if (!_roundTrips(record)) {
+            return "table " + std::to_string(record.table) + ", terminals " + std::to_string(record.firstTerminal) + " to "
+                + std::to_string(record.lastTerminal) + " do not read back";
+        }
+    }
+
+    // The junction tag is not packed, so it does not change the bytes
+    CableRecord tagged = records[1];
+    tagged.junctionTag = L"IJB-810";
+    if (packCableRecord(tagged) != packCableRecord(records[1])) return "the junction tag changes the packed bytes";
+
+    // Little endian, after the version and the cable type
+    PackedCableRecord data = packCableRecord({ L"", 0x0102, 0x03040506, 0x0708090A, CableType::PAIR4 });
+    const PackedCableRecord expected = { 1, 2, 0x02, 0x01, 0x06, 0x05, 0x04, 0x03, 0x0A, 0x09, 0x08, 0x07 };
+    if (data != expected) return "the packed bytes are not little endian";
+
+    // Truncated, padded or unknown bytes are rejected
+    CableRecord unpacked;
+    if (unpackCableRecord(nullptr, CABLE_RECORD_SIZE, unpacked)) return "no bytes were read as a record";
+    if (unpackCableRecord(data.data(), CABLE_RECORD_SIZE - 1, unpacked)) return "a truncated record was read";
+
+    std::vector<std::uint8_t> padded(data.begin(), data.end());
+    padded.push_back(0);
+    if (unpackCableRecord(padded.data(), padded.size(), unpacked)) return "a padded record was read";
+
+    data[0] = 2;
+    if (unpackCableRecord(data.data(), data.size(), unpacked)) return "a record of an unknown version was read";
+
+    return std::string();
+}
+
+/**
+ * @brief Move the bottom cable of every table with more than one cable four terminals down.
+ *
+ * @param moveJunctions    Move its junction termination.
+ * @param moveFieldDevices Move its field device termination.
+ * @param moved            Receives whether each block moved.
+ * @param expected         Receives the terminal of FLDTAG1 each renumbered block must land on.
+ */
+static void _moveBottomCables(std::vector<ReindexBlock>& blocks, bool moveJunctions, bool moveFieldDevices, std::vector<bool>& moved, std::vector<int>& expected) {
+    moved.assign(blocks.size(), false);
+    expected.assign(blocks.size(), 0);
+
+    // The lowest junction termination of each prefix, and how many it has
+    std::map<std::wstring, std::pair<size_t, int>> bottoms;
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        const ReindexBlock& block = blocks[i];
+        if ((block.kind != BlockKind::JUNCTION_TERM && block.kind != BlockKind::JUNCTION_TERM7) || block.fieldTags.empty()) continue;
+
+        std::wstring prefix = block.fieldTags[0].substr(0, block.fieldTags[0].find(L'('));
+        auto it = bottoms.find(prefix);
+        if (it == bottoms.end()) {
+            bottoms[prefix] = { i, 1 };
+            continue;
+        }
+
+        if (block.y < blocks[it->second.first].y) it->second.first = i;
+        it->second.second++;
+    }
+
+    for (const auto& entry : bottoms) {
+        if (entry.second.second < 2) continue;
+
+        // The cable's field device termination has the same tags
+        const std::wstring fieldTag = blocks[entry.second.first].fieldTags[0];
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            ReindexBlock& block = blocks[i];
+            if (block.fieldTags.empty() || block.fieldTags[0] != fieldTag) continue;
+
+            bool junction = block.kind == BlockKind::JUNCTION_TERM || block.kind == BlockKind::JUNCTION_TERM7;
+            if (junction ? moveJunctions : moveFieldDevices) {
+                block.y -= 1.0;
+                moved[i] = true;
+            }
+
+            if (moveJunctions) expected[i] = std::stoi(fieldTag.substr(fieldTag.find(L'(') + 1)) + 4;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    std::vector<int> sizes = { 240, 1200, 4800 };
+    if (argc > 1) {
+        sizes.clear();
+        for (int i = 1; i < argc; ++i) sizes.push_back(std::stoi(argv[i]));
+    }
+
+    std::string recordError = _checkCableRecords();
+    if (!recordError.empty()) {
+        std::fprintf(stderr, "Cable records: %s\n", recordError.c_str());
+        return 1;
+    }
+
+    std::printf("%10s %10s %8s %10s %10s %12s %10s %14s %14s %14s\n", "cables", "blocks", "tables", "fresh", "stale", "tags", "moved", "fresh (s)", "stale (s)", "moved (s)");
+
+    for (int count : sizes) {
+        // Boxes that fit share the two tables of a large box
+        BoxPlanner planBox = [](int box, const std::vector<Cable>& cables) {
+            LayoutPlan plan = LayoutPlanner(BoxSize::LARGE).plan(cables);
+            if (plan.overflows()) plan = LayoutPlanner(BoxSize::CUSTOM, { -11.0 * box, 0.0 }).plan(cables);
+            return plan;
+        };
+
+        // Every drawn cable's record must read back
+        size_t recordErrors = 0;
+        BoxDrawn checkRecords = [&recordErrors](int, const std::wstring& junctionTag, std::vector<Cable>& cables, const LayoutPlan& plan) {
+            for (const CableRecord& record : getCableRecords(cables, plan, junctionTag)) {
+                if (!_roundTrips(record)) recordErrors++;
+            }
+        };
+
+        DrawBuffer buffer = generateDrawing(count, 1, planBox, checkRecords);
+        std::vector<ReindexBlock> blocks = readReindexBlocks(buffer);
+
+        Clock::time_point start = Clock::now();
+        ReindexResult fresh = reindexTables(blocks);
+        double freshSeconds = secondsSince(start);
+
+        // Make every terminal number stale
+        size_t tagCount = 0;
+        for (ReindexBlock& block : blocks) {
+            for (std::wstring& text : block.fieldTags) {
+                size_t paren = text.find(L'(');
+                if (paren == std::wstring::npos) continue;
+
+                text.replace(paren, std::wstring::npos, L"(0)");
+                tagCount++;
+            }
+        }
+
+        start = Clock::now();
+        ReindexResult stale = reindexTables(blocks);
+        double staleSeconds = secondsSince(start);
+
+        // Move one cable of every table, or one of its terminations, then the whole drawing
+        std::vector<bool> moved;
+        std::vector<int> expected;
+        bool movedMatch = true;
+        size_t movedCount = 0;
+        double movedSeconds = 0.0;
+
+        for (int scenario = 0; scenario < 3; ++scenario) {
+            blocks = readReindexBlocks(buffer);
+            _moveBottomCables(blocks, scenario != 2, scenario != 1, moved, expected);
+
+            start = Clock::now();
+            ReindexResult movedCables = reindexMoved(blocks, moved);
+            if (scenario == 0) {
+                movedSeconds = secondsSince(start);
+                movedCount = movedCables.cableCount;
+            }
+
+            movedMatch = movedMatch && movedCables.firstTerminals == expected;
+        }
+
+        for (ReindexBlock& block : blocks) block.y += 10.0;
+        ReindexResult movedDrawing = reindexMoved(blocks, std::vector<bool>(blocks.size(), true));
+
+        std::printf("%10d %10zu %8zu %10zu %10zu %12zu %10zu %14.6f %14.6f %14.6f\n",
+            count, blocks.size(), fresh.tables.size(), fresh.updates.size(), stale.updates.size(), tagCount, movedCount, freshSeconds, staleSeconds, movedSeconds);
+
+        if (!fresh.updates.empty() || stale.updates.size() != tagCount || fresh.unmatchedCount != 0) {
+            std::printf("Error: renumbering does not match the drawing\n");
+            return 1;
+        }
+
+        if (recordErrors != 0) {
+            std::printf("Error: %zu cable records do not read back\n", recordErrors);
+            return 1;
+        }
+
+        if (!movedMatch || !movedDrawing.updates.empty()) {
+            std::printf("Error: moved cables are not renumbered against their tables\n");
+            return 1;
+        }
+    }
+
+    return 0;
+}
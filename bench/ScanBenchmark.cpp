@@ -0,0 +1,162 @@
+/**
+ * @file ScanBenchmark.cpp
+ * @brief Benchmark of rebuilding the terminal table of large drawings.
+ *
+ * Draws generated junction boxes into a DrawBuffer and reads every block and
+ * attribute back the way EXPORTTERMINALS reads them from model space. Each
+ * box is an enclosure with a table drawn to the left and one drawn to the
+ * right, side by side with the other boxes, and cables have one or two
+ * devices.
+ *
+ * The rebuilt table must match the terminals the layout planner placed each
+ * device terminal on, as must the rows `getTerminalRows` gives for the plans.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "BoxCatalog.h"
+#include "Cable.h"
+#include "DrawBuffer.h"
+#include "Drawing.h"
+#include "LayoutPlanner.h"
+#include "TerminalTable.h"
+
+// -----------------------------------------------------------------------------
+// Internal Constants
+// -----------------------------------------------------------------------------
+
+static const int _boxesPerRow = 20;     ///< Boxes drawn side by side before starting a new row.
+static const double _boxWidth = 40.0;   ///< Horizontal distance between two boxes.
+static const double _boxHeight = 100.0; ///< Vertical distance between two rows of boxes.
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Get the terminals each device terminal was placed on.
+ */
+static void _expectRows(const std::vector<Cable>& cables, const LayoutPlan& plan, const std::wstring& junctionTag, std::vector<TerminalRow>& rows) {
+    for (size_t i = 0; i < cables.size(); ++i) {
+        TerminalRow row;
+        row.junctionTag = junctionTag;
+        row.table = plan[i].table;
+        row.cableLabel = getCableLabel(cables[i]);
+
+        int terminal = plan[i].terminal;
+        for (const Device& device : cables[i].getDevices()) {
+            std::string tag = device.getCombinedTag();
+            row.deviceTag.assign(tag.begin(), tag.end());
+
+            // Same terminals and labels as drawDevice
+            std::vector<std::pair<int, std::wstring>> wires = { { 0, L"+" }, { 1, L"-" } };
+            if (device.getTerminalFootprint() == 4) wires.push_back({ 2, L"REF" });
+            if (device.getTerminalFootprint() == 6) wires = { { 0, L"L" }, { 1, L"N" }, { 3, L"5" }, { 4, L"6" } };
+
+            for (const auto& wire : wires) {
+                row.terminal = terminal + wire.first;
+                row.wire = wire.second;
+                rows.push_back(row);
+            }
+
+            terminal += device.getTerminalFootprint();
+        }
+    }
+}
+
+/**
+ * @brief Draw `count` cables as enclosures with a table on each side.
+ *
+ * @param rows    Receives the terminals the cables are drawn on.
+ * @param planned Receives the terminals `getTerminalRows` gives for each box.
+ */
+static DrawBuffer _generateDrawing(int count, std::vector<TerminalRow>& rows, std::vector<TerminalRow>& planned) {
+    BoxPlanner planBox = [](int box, const std::vector<Cable>& cables) {
+        double x = _boxWidth * (box % _boxesPerRow);
+        double y = -_boxHeight * (box / _boxesPerRow);
+
+        Enclosure enclosure;
+        enclosure.name = "Generated";
+        enclosure.tables = { { 60, x + 11.1875, y, false }, { 1000, x + 21.8125, y, true } };
+
+        return LayoutPlanner(enclosure).plan(cables);
+    };
+
+    BoxDrawn drawn = [&rows, &planned](int, const std::wstring& junctionTag, std::vector<Cable>& cables, const LayoutPlan& plan) {
+        _expectRows(cables, plan, junctionTag, rows);
+
+        std::vector<TerminalRow> boxRows = getTerminalRows(cables, plan, junctionTag);
+        planned.insert(planned.end(), boxRows.begin(), boxRows.end());
+    };
+
+    DrawBuffer buffer = generateDrawing(count, 2, planBox, drawn);
+
+    auto byTerminal = [](const TerminalRow& a, const TerminalRow& b) {
+        return std::tie(a.junctionTag, a.table, a.terminal, a.wire) < std::tie(b.junctionTag, b.table, b.terminal, b.wire);
+    };
+    std::sort(rows.begin(), rows.end(), byTerminal);
+    std::sort(planned.begin(), planned.end(), byTerminal);
+
+    return buffer;
+}
+
+static bool _sameRow(const TerminalRow& a, const TerminalRow& b) {
+    return std::tie(a.junctionTag, a.table, a.terminal, a.cableLabel, a.deviceTag, a.wire)
+        == std::tie(b.junctionTag, b.table, b.terminal, b.cableLabel, b.deviceTag, b.wire);
+}
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    std::vector<int> sizes = { 500, 5000, 20000 };
+    if (argc > 1) {
+        sizes.clear();
+        for (int i = 1; i < argc; ++i) sizes.push_back(std::stoi(argv[i]));
+    }
+
+    std::printf("%10s %10s %10s %10s %14s\n", "cables", "blocks", "terminals", "unmatched", "seconds");
+
+    for (int count : sizes) {
+        std::vector<TerminalRow> expected;
+        std::vector<TerminalRow> planned;
+        DrawBuffer buffer = _generateDrawing(count, expected, planned);
+        std::vector<ScanBlock> blocks = readScanBlocks(buffer);
+
+        Clock::time_point start = Clock::now();
+        TerminalTable table = buildTerminalTable(blocks);
+        double seconds = secondsSince(start);
+
+        std::printf("%10zu %10zu %10zu %10zu %14.6f\n", table.cables.size(), blocks.size(), table.rows.size(), table.unmatchedCount, seconds);
+
+        bool matches = table.cables.size() == static_cast<size_t>(count) && table.unnumberedCount == 0 && table.unmatchedCount == 0
+                    && std::equal(table.rows.begin(), table.rows.end(), expected.begin(), expected.end(), _sameRow);
+
+        if (!matches) {
+            std::printf("Error: terminal table does not match the drawing\n");
+            return 1;
+        }
+
+        if (!std::equal(planned.begin(), planned.end(), expected.begin(), expected.end(), _sameRow)) {
+            std::printf("Error: planned terminal rows do not match the drawing\n");
+            return 1;
+        }
+    }
+
+    return 0;
+}
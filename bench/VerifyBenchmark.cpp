@@ -0,0 +1,139 @@
+/**
+ * @file VerifyBenchmark.cpp
+ * @brief Benchmark of checking large drawings against revised workbooks.
+ *
+ * Draws generated junction boxes into a DrawBuffer as custom boxes side by
+ * side, reads them back the way VERIFYDRAWING does, then revises some of the
+ * workbook cables: every 40th cable changes its cable type, and every 70th
+ * with more than one device renames its last device. Neither moves any
+ * cable, so exactly the revised cables must be reported by
+ * verifyTerminalTable, and nothing else.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include <cstdio>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "BenchCommon.h"
+#include "Cable.h"
+#include "CableVerify.h"
+#include "DrawBuffer.h"
+#include "Drawing.h"
+#include "LayoutPlanner.h"
+#include "TerminalTable.h"
+
+// -----------------------------------------------------------------------------
+// Internal Constants
+// -----------------------------------------------------------------------------
+
+static const int _boxesPerRow = 20;     ///< Boxes drawn side by side before starting a new row.
+static const double _boxWidth = 20.0;   ///< Horizontal distance between two boxes.
+static const double _boxHeight = 100.0; ///< Vertical distance between two rows of boxes.
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Copy a cable with a different cable type, or its last device renamed.
+ */
+static Cable _revise(const Cable& cable, bool changeType) {
+    CableType cableType = cable.getCableType();
+    if (changeType) cableType = (cableType == CableType::TRIAD1) ? CableType::PAIR1 : CableType::TRIAD1;
+
+    Cable revised(cableType, cable.getSystemType(), cable.getIOType());
+
+    std::vector<Device> devices = cable.getDevices();
+    for (size_t d = 0; d < devices.size(); ++d) {
+        std::string tag = devices[d].getCombinedTag();
+        if (!changeType && d + 1 == devices.size()) tag += "R";
+
+        revised.addDevice(Device(tag, devices[d].getTerminalFootprint()));
+    }
+
+    return revised;
+}
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    std::vector<int> sizes = { 2400, 5000, 20000 };
+    if (argc > 1) {
+        sizes.clear();
+        for (int i = 1; i < argc; ++i) sizes.push_back(std::stoi(argv[i]));
+    }
+
+    std::printf("%10s %8s %10s %10s %12s %12s\n", "cables", "boxes", "revised", "reported", "scan (s)", "verify (s)");
+
+    for (int count : sizes) {
+        std::map<std::string, std::vector<Cable>> workbook;
+        std::set<std::wstring> revised;
+
+        BoxPlanner planBox = [](int box, const std::vector<Cable>& cables) {
+            LayoutPoint origin = { _boxWidth * (box % _boxesPerRow), -_boxHeight * (box / _boxesPerRow) };
+            return LayoutPlanner(BoxSize::CUSTOM, origin).plan(cables);
+        };
+
+        // Revise the workbook after each box was drawn
+        int index = 0;
+        BoxDrawn revise = [&](int box, const std::wstring& junctionTag, std::vector<Cable>& cables, const LayoutPlan&) {
+            for (Cable& cable : cables) {
+                bool changeType = index % 40 == 0;
+                bool rename = index % 70 == 0 && cable.getDevices().size() > 1;
+                index++;
+
+                if (!changeType && !rename) continue;
+
+                cable = _revise(cable, changeType);
+                revised.insert(junctionTag + L" " + getCableLabel(cable));
+            }
+
+            workbook["IJB-" + std::to_string(100 + box)] = cables;
+        };
+
+        DrawBuffer buffer = generateDrawing(count, 2, planBox, revise);
+
+        std::vector<ScanBlock> blocks = readScanBlocks(buffer);
+
+        Clock::time_point start = Clock::now();
+        TerminalTable table = buildTerminalTable(blocks);
+        double scanSeconds = secondsSince(start);
+
+        // The generated cables take the place of a workbook
+        CableLookup getCables = [&workbook](const std::string& junctionTag) {
+            auto it = workbook.find(junctionTag);
+            return it == workbook.end() ? std::vector<Cable>() : it->second;
+        };
+
+        start = Clock::now();
+        std::vector<CableMismatch> mismatches = verifyTerminalTable(getCables, table);
+        double verifySeconds = secondsSince(start);
+
+        std::printf("%10d %8zu %10zu %10zu %12.6f %12.6f\n", count, workbook.size(), revised.size(), mismatches.size(), scanSeconds, verifySeconds);
+
+        std::set<std::wstring> reported;
+        for (const CableMismatch& mismatch : mismatches) {
+            if (mismatch.kind == MismatchKind::CHANGED) reported.insert(mismatch.drawn.junctionTag + L" " + mismatch.drawn.cableLabel);
+        }
+
+        if (mismatches.size() != revised.size() || reported != revised) {
+            std::printf("Error: reported cables do not match the revised cables\n");
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,336 @@
+/**
+ * @file WorkbookBenchmark.cpp
+ * @brief Benchmark of opening generated IO list workbooks.
+ *
+ * Writes a workbook with a Cable Schedule Data sheet and an IO List sheet,
+ * without OpenXLSX, and times `Workbook::open` on it. Junctions have from one
+ * to ninety cables of one or two devices, so some of them fit in no standard
+ * box. Every junction must read back with the cables and terminal footprint
+ * it was generated with.
+ *
+ * With `-o workbook.xlsx` a single workbook of the first size is written and
+ * kept, for the JunctionBatch check.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <zlib.h>
+
+#include "BenchCommon.h"
+#include "Cable.h"
+#include "Device.h"
+#include "Workbook.h"
+
+// -----------------------------------------------------------------------------
+// Internal Types
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief What a generated junction must read back as.
+ */
+struct _ExpectedJunction {
+    size_t cables = 0;  ///< Number of cables.
+    int footprint = 0;  ///< Terminals used by every device of its cables.
+};
+
+/**
+ * @brief A generated workbook, as the text of each sheet.
+ */
+struct _GeneratedWorkbook {
+    std::string cableSchedule;  ///< <sheetData> rows of the Cable Schedule Data sheet.
+    std::string ioList;         ///< <sheetData> rows of the IO List sheet.
+    std::map<std::string, _ExpectedJunction> junctions; ///< Every junction by tag.
+};
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief An inline string cell.
+ */
+static std::string _cell(char column, int row, const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '&') escaped += "&amp;";
+        else if (c == '<') escaped += "&lt;";
+        else if (c == '>') escaped += "&gt;";
+        else escaped += c;
+    }
+
+    return "<c r=\"" + std::string(1, column) + std::to_string(row) + "\" t=\"inlineStr\"><is><t>" + escaped + "</t></is></c>";
+}
+
+/**
+ * @brief Generate `count` cables spread over junctions of 1 to 90 cables.
+ */
+static _GeneratedWorkbook _generateWorkbook(int count) {
+    static const char* const quantities[] = { "1 Pair", "1 Pair", "2 Pair", "1 Triad", "4 Pair", "1-7/C" };
+    static const char* const prefixes[] = { "TT", "PT", "LSLL", "FT", "ZSC", "SDV" };
+    static const char* const specs[] = { "RTD", "PRESSURE", "ULTRASONIC SW", "CORIOLIS FLOW", "LIMIT SW", "SOLENOID" };
+
+    std::mt19937 rng(20261016);
+    _GeneratedWorkbook workbook;
+
+    int scheduleRow = 3;
+    int ioRow = 7;
+    int device = 0;
+
+    for (int cable = 0, junction = 0; cable < count; ++junction) {
+        std::string junctionTag = "IJB-" + std::to_string(100 + junction);
+        _ExpectedJunction& expected = workbook.junctions[junctionTag];
+
+        int cables = 1 + rng() % 90;
+        for (int c = 0; c < cables && cable < count; ++c, ++cable) {
+            std::string quantity = quantities[rng() % 6];
+            std::string ioType = (rng() % 2) ? "DI" : "AI";
+            std::string systemType = (rng() % 3 == 0) ? "Safety" : "Control";
+
+            int devices = 1 + rng() % 2;
+            for (int d = 0; d < devices; ++d, ++device) {
+                int prefix = rng() % 6;
+                int spec = (rng() % 2) ? prefix : 1;
+                std::string tag = std::string(prefixes[prefix]) + " " + std::to_string(1000 + device);
+
+                // Only the first row of a cable has a quantity
+                workbook.cableSchedule += "<row r=\"" + std::to_string(scheduleRow) + "\">";
+                if (d == 0) workbook.cableSchedule += _cell('A', scheduleRow, quantity);
+                workbook.cableSchedule += _cell('C', scheduleRow, junctionTag) + _cell('D', scheduleRow, tag) + "</row>";
+                scheduleRow++;
+
+                workbook.ioList += "<row r=\"" + std::to_string(ioRow) + "\">";
+                workbook.ioList += _cell('B', ioRow, tag) + _cell('E', ioRow, specs[spec]) + _cell('G', ioRow, ioType) + _cell('H', ioRow, systemType);
+                workbook.ioList += "</row>";
+                ioRow++;
+
+                expected.footprint += Device::footprintFromCells(tag, specs[spec]);
+            }
+
+            expected.cables++;
+        }
+    }
+
+    return workbook;
+}
+
+/**
+ * @brief Write little endian bytes.
+ */
+static void _put(std::string& out, std::uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) out += static_cast<char>((value >> (8 * i)) & 0xFF);
+}
+
+/**
+ * @brief Write a ZIP archive of uncompressed parts.
+ *
+ * @throws std::runtime_error if the file cannot be written.
+ */
+static size_t _writeZip(const std::string& filename, const std::vector<std::pair<std::string, std::string>>& parts) {
+    std::string archive;
+    std::string directory;
+
+    for (const auto& part : parts) {
+        std::uint32_t crc = crc32(0L, reinterpret_cast<const Bytef*>(part.second.data()), static_cast<uInt>(part.second.size()));
+        std::uint32_t size = static_cast<std::uint32_t>(part.second.size());
+        std::uint32_t offset = static_cast<std::uint32_t>(archive.size());
+        std::uint32_t nameLength = static_cast<std::uint32_t>(part.first.size());
+
+        // Local file header, stored, dated 1980-01-01
+        _put(archive, 0x04034b50, 4);
+        _put(archive, 20, 2);
+        _put(archive, 0, 2);
+        _put(archive, 0, 2);
+        _put(archive, 0, 2);
+        _put(archive, 0x21, 2);
+        _put(archive, crc, 4);
+        _put(archive, size, 4);
+        _put(archive, size, 4);
+        _put(archive, nameLength, 2);
+        _put(archive, 0, 2);
+        archive += part.first;
+        archive += part.second;
+
+        // Central directory entry
+        _put(directory, 0x02014b50, 4);
+        _put(directory, 20, 2);
+        _put(directory, 20, 2);
+        _put(directory, 0, 2);
+        _put(directory, 0, 2);
+        _put(directory, 0, 2);
+        _put(directory, 0x21, 2);
+        _put(directory, crc, 4);
+        _put(directory, size, 4);
+        _put(directory, size, 4);
+        _put(directory, nameLength, 2);
+        _put(directory, 0, 2);
+        _put(directory, 0, 2);
+        _put(directory, 0, 2);
+        _put(directory, 0, 2);
+        _put(directory, 0, 4);
+        _put(directory, offset, 4);
+        directory += part.first;
+    }
+
+    std::uint32_t directoryOffset = static_cast<std::uint32_t>(archive.size());
+    archive += directory;
+
+    // End of central directory
+    _put(archive, 0x06054b50, 4);
+    _put(archive, 0, 2);
+    _put(archive, 0, 2);
+    _put(archive, static_cast<std::uint32_t>(parts.size()), 2);
+    _put(archive, static_cast<std::uint32_t>(parts.size()), 2);
+    _put(archive, static_cast<std::uint32_t>(directory.size()), 4);
+    _put(archive, directoryOffset, 4);
+    _put(archive, 0, 2);
+
+    std::ofstream file(filename, std::ios::binary);
+    file.write(archive.data(), archive.size());
+    if (!file) {
+        throw std::runtime_error("Failed to write " + filename);
+    }
+
+    return archive.size();
+}
+
+/**
+ * @brief Write a generated workbook as an .xlsx file.
+ *
+ * @return Size of the file in bytes.
+ */
+static size_t _writeWorkbook(const std::string& filename, const _GeneratedWorkbook& workbook) {
+    static const std::string header = "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n";
+    static const std::string relationships = "http://schemas.openxmlformats.org/officeDocument/2006/relationships";
+    static const std::string spreadsheet = "http://schemas.openxmlformats.org/spreadsheetml/2006/main";
+
+    auto sheet = [&](const std::string& rows) {
+        return header + "<worksheet xmlns=\"" + spreadsheet + "\"><sheetData>" + rows + "</sheetData></worksheet>";
+    };
+
+    return _writeZip(filename, {
+        { "[Content_Types].xml", header +
+            "<Types xmlns=\"http://schemas.openxmlformats.org/package/2006/content-types\">"
+            "<Default Extension=\"rels\" ContentType=\"application/vnd.openxmlformats-package.relationships+xml\"/>"
+            "<Default Extension=\"xml\" ContentType=\"application/xml\"/>"
+            "<Override PartName=\"/xl/workbook.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.spreadsheetml.sheet.main+xml\"/>"
+            "<Override PartName=\"/xl/worksheets/sheet1.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.spreadsheetml.worksheet+xml\"/>"
+            "<Override PartName=\"/xl/worksheets/sheet2.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.spreadsheetml.worksheet+xml\"/>"
+            "</Types>" },
+        { "_rels/.rels", header +
+            "<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">"
+            "<Relationship Id=\"rId1\" Type=\"" + relationships + "/officeDocument\" Target=\"xl/workbook.xml\"/>"
+            "</Relationships>" },
+        { "xl/workbook.xml", header +
+            "<workbook xmlns=\"" + spreadsheet + "\" xmlns:r=\"" + relationships + "\"><sheets>"
+            "<sheet name=\"Cable Schedule Data\" sheetId=\"1\" r:id=\"rId1\"/>"
+            "<sheet name=\"IO List\" sheetId=\"2\" r:id=\"rId2\"/>"
+            "</sheets></workbook>" },
+        { "xl/_rels/workbook.xml.rels", header +
+            "<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">"
+            "<Relationship Id=\"rId1\" Type=\"" + relationships + "/worksheet\" Target=\"worksheets/sheet1.xml\"/>"
+            "<Relationship Id=\"rId2\" Type=\"" + relationships + "/worksheet\" Target=\"worksheets/sheet2.xml\"/>"
+            "</Relationships>" },
+        { "xl/worksheets/sheet1.xml", sheet(workbook.cableSchedule) },
+        { "xl/worksheets/sheet2.xml", sheet(workbook.ioList) }
+    });
+}
+
+/**
+ * @brief Check that every junction read back as it was generated.
+ *
+ * @return The number of junctions that differ.
+ */
+static int _checkJunctions(const Workbook& workbook, const _GeneratedWorkbook& generated) {
+    int mismatches = 0;
+
+    std::vector<std::string> tags = workbook.getJunctionTags();
+    if (tags.size() != generated.junctions.size()) mismatches++;
+
+    for (const std::string& tag : tags) {
+        auto expected = generated.junctions.find(tag);
+        if (expected == generated.junctions.end()) {
+            mismatches++;
+            continue;
+        }
+
+        std::vector<Cable> cables = workbook.getCables(tag);
+
+        int footprint = 0;
+        for (const Cable& cable : cables) footprint += cable.getTerminalFootprint();
+
+        if (cables.size() != expected->second.cables || footprint != expected->second.footprint) mismatches++;
+    }
+
+    return mismatches;
+}
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    std::string output;
+    if (argc >= 3 && std::string(argv[1]) == "-o") {
+        output = argv[2];
+        argc -= 2;
+        argv += 2;
+    }
+
+    std::vector<int> sizes = { 2000, 20000, 200000 };
+    if (argc > 1) {
+        sizes.clear();
+        for (int i = 1; i < argc; ++i) sizes.push_back(std::stoi(argv[i]));
+    }
+    if (!output.empty()) sizes.resize(1);
+
+    std::printf("%10s %10s %12s %14s %14s\n", "cables", "junctions", "bytes", "write (s)", "open (s)");
+
+    for (int count : sizes) {
+        std::string filename = output.empty() ? "WorkbookBenchmark.xlsx" : output;
+
+        try {
+            Clock::time_point start = Clock::now();
+            _GeneratedWorkbook generated = _generateWorkbook(count);
+            size_t bytes = _writeWorkbook(filename, generated);
+            double writeSeconds = secondsSince(start);
+
+            start = Clock::now();
+            std::shared_ptr<const Workbook> workbook = Workbook::open(filename);
+            double openSeconds = secondsSince(start);
+
+            std::printf("%10d %10zu %12zu %14.6f %14.6f\n", count, generated.junctions.size(), bytes, writeSeconds, openSeconds);
+
+            int mismatches = _checkJunctions(*workbook, generated);
+            if (mismatches != 0) {
+                std::fprintf(stderr, "%d junctions read back differently from %d cables\n", mismatches, count);
+                return 1;
+            }
+        } catch (const std::exception& e) {
+            std::fprintf(stderr, "%s\n", e.what());
+            return 1;
+        }
+
+        if (output.empty()) std::remove(filename.c_str());
+    }
+
+    return 0;
+}
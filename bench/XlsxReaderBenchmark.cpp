@@ -0,0 +1,186 @@
+/**
+ * @file XlsxReaderBenchmark.cpp
+ * @brief Side-by-side benchmark of the OpenXLSX and streaming workbook readers.
+ *
+ * Both readers extract columns 1, 3 and 4 of "Cable Schedule Data" and columns
+ * 2, 5, 7 and 8 of "IO List". Each reader runs in its own child process so
+ * that the reported peak memory belongs to that reader alone.
+ *
+ * Usage:
+ *     XlsxReaderBenchmark <workbook.xlsx>...
+ *     XlsxReaderBenchmark --generate <rows> <workbook.xlsx>
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "OpenXLSX.hpp"
+
+#include "BenchCommon.h"
+#include "XlsxStreamReader.h"
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Peak resident memory of this process in KiB.
+ */
+static long _peakMemoryKB() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+    return static_cast<long>(counters.PeakWorkingSetSize / 1024);
+#else
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+#endif
+}
+
+/**
+ * @brief Read the columns through OpenXLSX's random-access cells, as the importer used to.
+ *
+ * @return The number of cells read.
+ */
+static size_t _readOpenXLSX(const std::string& filename) {
+    size_t cells = 0;
+
+    OpenXLSX::XLDocument doc;
+    doc.open(filename);
+
+    OpenXLSX::XLWorksheet cableWks = doc.workbook().worksheet("Cable Schedule Data");
+    for (int row = 3; cableWks.cell(row, 4).value() != ""; ++row) {
+        bool newCable = cableWks.cell(row, 1).value().typeAsString() == "string";
+        std::string quantity = newCable ? cableWks.cell(row, 1).value().getString() : "";
+        std::string junctionTag = cableWks.cell(row, 3).value().getString();
+        std::string combinedTag = cableWks.cell(row, 4).value().getString();
+        cells += 3;
+    }
+
+    OpenXLSX::XLWorksheet ioWks = doc.workbook().worksheet("IO List");
+    for (int row = 7; ioWks.cell(row, 2).value() != ""; ++row) {
+        std::string combinedTag = ioWks.cell(row, 2).value().getString();
+        std::string instrumentSpec = ioWks.cell(row, 5).value().getString();
+        std::string ioType = ioWks.cell(row, 7).value().getString();
+        std::string systemType = ioWks.cell(row, 8).value().getString();
+        cells += 4;
+    }
+
+    doc.close();
+
+    return cells;
+}
+
+/**
+ * @brief Read the columns with the streaming reader.
+ *
+ * @return The number of cells read.
+ */
+static size_t _readStreaming(const std::string& filename) {
+    XlsxStreamReader reader(filename);
+
+    std::vector<XlsxTable> tables = reader.read({
+        { "Cable Schedule Data", 3, { 1, 3, 4 }, 4 },
+        { "IO List", 7, { 2, 5, 7, 8 }, 2 }
+    });
+
+    return tables[0].size() * 3 + tables[1].size() * 4;
+}
+
+/**
+ * @brief Write a workbook with `rows` devices and a few unused columns, like a project IO list.
+ */
+static void _generateWorkbook(const std::string& filename, int rows) {
+    OpenXLSX::XLDocument doc;
+    doc.create(filename);
+
+    doc.workbook().addWorksheet("Cable Schedule Data");
+    doc.workbook().addWorksheet("IO List");
+
+    OpenXLSX::XLWorksheet cableWks = doc.workbook().worksheet("Cable Schedule Data");
+    OpenXLSX::XLWorksheet ioWks = doc.workbook().worksheet("IO List");
+
+    for (int i = 0; i < rows; ++i) {
+        std::string tag = "TT " + std::to_string(i);
+
+        if (i % 2 == 0) cableWks.cell(3 + i, 1).value() = "2 Pair";
+        cableWks.cell(3 + i, 2).value() = i;
+        cableWks.cell(3 + i, 3).value() = "IJB-" + std::to_string(800 + i % 60);
+        cableWks.cell(3 + i, 4).value() = tag;
+        cableWks.cell(3 + i, 5).value() = "Field cable run " + std::to_string(i);
+
+        ioWks.cell(7 + i, 1).value() = i;
+        ioWks.cell(7 + i, 2).value() = tag;
+        ioWks.cell(7 + i, 3).value() = "Process temperature " + std::to_string(i);
+        ioWks.cell(7 + i, 5).value() = (i % 10 == 0) ? "RTD" : "PRESSURE";
+        ioWks.cell(7 + i, 7).value() = (i % 2 == 0) ? "AI" : "DI";
+        ioWks.cell(7 + i, 8).value() = (i % 3 == 0) ? "Safety" : "Control";
+        ioWks.cell(7 + i, 9).value() = "Rack 1 Slot " + std::to_string(i % 16);
+    }
+
+    doc.save();
+    doc.close();
+}
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    if (argc == 4 && std::strcmp(argv[1], "--generate") == 0) {
+        _generateWorkbook(argv[3], std::atoi(argv[2]));
+        return 0;
+    }
+
+    // Child process: run one reader and report its time and memory
+    if (argc == 4 && std::strcmp(argv[1], "--reader") == 0) {
+        bool streaming = std::strcmp(argv[2], "stream") == 0;
+
+        Clock::time_point start = Clock::now();
+        size_t cells = streaming ? _readStreaming(argv[3]) : _readOpenXLSX(argv[3]);
+        double seconds = secondsSince(start);
+
+        std::printf("%-10s %12zu %12.3f %14ld\n", argv[2], cells, seconds, _peakMemoryKB());
+        return 0;
+    }
+
+    if (argc < 2) {
+        std::fprintf(stderr, "Usage: %s <workbook.xlsx>...\n       %s --generate <rows> <workbook.xlsx>\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    for (int i = 1; i < argc; ++i) {
+        std::printf("\n%s\n", argv[i]);
+        std::printf("%-10s %12s %12s %14s\n", "reader", "cells", "seconds", "peak (KiB)");
+        std::fflush(stdout);
+
+        for (const char* reader : { "openxlsx", "stream" }) {
+            std::string command = std::string("\"") + argv[0] + "\" --reader " + reader + " \"" + argv[i] + "\"";
+            if (std::system(command.c_str()) != 0) {
+                std::fprintf(stderr, "%s reader failed\n", reader);
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file ArxDrawBackend.h
+ * @brief Interface for the ArxDrawBackend class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "BlockCache.h"
+#include "CablePrototypeCache.h"
+#include "DrawBuffer.h"
+#include "DrawingSession.h"
+
+/**
+ * @class ArxDrawBackend
+ * @brief Plays recorded draw commands into the working AutoCAD database.
+ *
+ * The commands are first sorted by block, so every block is inserted once and
+ * then gets all of its dynamic properties, its layer, its scale and all of its
+ * attributes in one call each. The whole buffer is drawn in one
+ * `DrawingSession`. Groups whose shape was already drawn in the command are
+ * copied from the first one, and only the attribute values that differ from
+ * it are written. The ids of every group's blocks are kept until the next
+ * buffer is played.
+ */
+class ArxDrawBackend : public DrawBackend
+{
+private:
+    BlockCache& _cache;               ///< Block definitions and layers of the command.
+    CablePrototypeCache& _prototypes; ///< Cable prototypes of the command.
+    std::vector<std::vector<AcDbObjectId>> _groupEntities; ///< Blocks of each group of the last buffer.
+
+    /**
+     * @brief Keep the ids of a drawn group's blocks.
+     */
+    void _addGroupEntities(const std::vector<AcDbBlockReference*>& entities);
+
+public:
+    /**
+     * @brief Construct a backend for the working database.
+     *
+     * @param cache      Block definitions and layers, shared by every box of a command.
+     * @param prototypes Cable prototypes, shared by every box of a command.
+     */
+    ArxDrawBackend(BlockCache& cache, CablePrototypeCache& prototypes);
+
+    void execute(const DrawBuffer& buffer) override;
+
+    /**
+     * @brief Get the blocks of every group of the last buffer played.
+     *
+     * @return One list per recorded group, in recorded order, with the blocks
+     *         in insertion order. Blocks that could not be drawn have a null id.
+     */
+    const std::vector<std::vector<AcDbObjectId>>& getGroupEntities() const;
+};
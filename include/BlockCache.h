@@ -0,0 +1,78 @@
+/**
+ * @file BlockCache.h
+ * @brief Interface for the BlockCache class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "helpers.h"
+
+/**
+ * @class BlockCache
+ * @brief Block definitions and layers resolved once for the duration of a command.
+ *
+ * The first insert of a block looks it up in the block table and extracts its
+ * attribute templates. Every later insert of the same block reuses them, so
+ * inserting is one append plus one clone per attribute. Layer names are
+ * resolved to layer table record ids the same way, and the positions of
+ * dynamic block properties are remembered per dynamic block definition.
+ *
+ * The cache holds ids of the working database, so it must be cleared at the
+ * end of the command that filled it.
+ */
+class BlockCache
+{
+private:
+    AcDbDatabase* _pDb = nullptr;                           ///< Database the cached ids belong to.
+    std::map<std::wstring, AcadBlockDefinition> _blocks;    ///< Block definitions by block name.
+    std::map<std::wstring, AcDbObjectId> _layers;           ///< Layer table records by layer name.
+    AcadDynPropertyCache _properties;                       ///< Dynamic property positions by definition.
+
+    /**
+     * @brief Drop every entry if the working database is not the cached one.
+     */
+    void _checkDatabase(AcDbDatabase* pDb);
+
+public:
+    /**
+     * @brief Get a block definition prepared for insertion.
+     *
+     * @param pDb       The database to look the block up in.
+     * @param blockName The name of the block.
+     * @return          The definition, or nullptr if the block is not in the drawing.
+     */
+    const AcadBlockDefinition* getBlock(AcDbDatabase* pDb, const wchar_t* blockName);
+
+    /**
+     * @brief Get the id of a layer.
+     *
+     * @param pDb       The database to look the layer up in.
+     * @param layerName The name of the layer.
+     * @return          The layer table record, or a null id if the layer does not exist.
+     */
+    AcDbObjectId getLayer(AcDbDatabase* pDb, const wchar_t* layerName);
+
+    /**
+     * @brief Get the dynamic property positions shared by every reference.
+     *
+     * @return The cache, to pass to `acadSetDynBlockProperties`.
+     */
+    AcadDynPropertyCache& getDynProperties();
+
+    /**
+     * @brief Release every cached definition, layer and property position.
+     */
+    void clear();
+};
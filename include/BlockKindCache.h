@@ -0,0 +1,54 @@
+/**
+ * @file BlockKindCache.h
+ * @brief Interface for the BlockKindCache class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <map>
+
+#include "Drawing.h"
+#include "helpers.h"
+
+/**
+ * @class BlockKindCache
+ * @brief Block kinds resolved once per block table record for the duration of a command.
+ *
+ * Resolving the name of an anonymous dynamic block opens its block table
+ * record and its dynamic definition. Every reference sharing a block table
+ * record has the same kind, so a selection of thousands of instances only
+ * resolves each definition once.
+ *
+ * The cache holds ids of the working database, so it must not outlive the
+ * command that filled it.
+ */
+class BlockKindCache
+{
+private:
+    std::map<AcDbObjectId, BlockKind> _kinds;   ///< Block kinds by block table record.
+
+public:
+    /**
+     * @brief Get the kind of a block reference.
+     *
+     * @param pBlockRef The block reference, open for read.
+     * @param kind      Receives the kind of the block.
+     * @return          Acad::ErrorStatus indicating success or failure. Failures
+     *                  are not cached.
+     */
+    Acad::ErrorStatus getKind(AcDbBlockReference* pBlockRef, BlockKind& kind);
+
+    /**
+     * @brief Release every cached kind.
+     */
+    void clear();
+};
@@ -0,0 +1,157 @@
+/**
+ * @file BoxCatalog.h
+ * @brief Interface for the enclosure geometry used to plan junction boxes.
+ *
+ * The standard enclosures are described by constexpr data so that planning
+ * them is specialized at compile time. Other enclosures with any number of
+ * terminal tables can be loaded at run time with `BoxCatalog::open`.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <vector>
+
+/**
+ * @enum BoxSize
+ * @brief Predefined enclosure footprints supported by the tool.
+ */
+enum BoxSize {
+    SMALL,  ///< 12" × 12" × 6" enclosure
+    MEDIUM, ///< 16" × 16" × 6" enclosure
+    LARGE,  ///< 24" × 24" × 8" enclosure
+    CUSTOM  ///< Custom enclosure. User will place the cables
+};
+
+/**
+ * @struct TableSpec
+ * @brief A terminal table inside an enclosure.
+ */
+struct TableSpec {
+    int capacity;   ///< Number of terminals on the table.
+    double originX; ///< X coordinate of the first terminal's junction termination block.
+    double originY; ///< Y coordinate of the first terminal's junction termination block.
+    bool flip;      ///< true if cables on this table are drawn to the right instead of to the left.
+};
+
+/**
+ * @struct BoxSpec
+ * @brief Compile-time description of an enclosure with `N` terminal tables.
+ */
+template <size_t N>
+struct BoxSpec {
+    const char* name;               ///< Name shown to the user (e.g. "24x24x8").
+    std::array<TableSpec, N> tables; ///< Terminal tables, in the order they are filled.
+
+    /**
+     * @brief Get the total number of terminals in the enclosure.
+     *
+     * @return The sum of every table's capacity.
+     */
+    constexpr int getCapacity() const {
+        int capacity = 0;
+        for (const TableSpec& table : tables) capacity += table.capacity;
+        return capacity;
+    }
+};
+
+/// The 12" × 12" × 6" enclosure.
+constexpr BoxSpec<1> SMALL_BOX = { "12x12x6", {{
+    { 24, 19.3750, 12.4977, false }
+}} };
+
+/// The 16" × 16" × 6" enclosure.
+constexpr BoxSpec<1> MEDIUM_BOX = { "16x16x6", {{
+    { 42, 19.3750, 14.7500, false }
+}} };
+
+/// The 24" × 24" × 8" enclosure. The second table faces the first.
+constexpr BoxSpec<2> LARGE_BOX = { "24x24x8", {{
+    { 72, 11.1875, 18.3250, false },
+    { 72, 21.8125, 18.3250, true }
+}} };
+
+/**
+ * @struct Enclosure
+ * @brief Run-time description of an enclosure with any number of terminal tables.
+ */
+struct Enclosure {
+    std::string name;              ///< Name shown to the user (e.g. "36x36x10").
+    std::vector<TableSpec> tables; ///< Terminal tables, in the order they are filled.
+
+    /**
+     * @brief Get the total number of terminals in the enclosure.
+     *
+     * @return The sum of every table's capacity.
+     */
+    int getCapacity() const;
+};
+
+/**
+ * @class BoxCatalog
+ * @brief Enclosures loaded from a catalog file.
+ *
+ * The file is plain text with one terminal table per line:
+ *
+ *     # name, capacity, origin x, origin y, flip
+ *     36x36x10, 96, 11.1875, 26.0750, 0
+ *     36x36x10, 96, 21.8125, 26.0750, 1
+ *
+ * Lines sharing a name make up one enclosure, with its tables filled in the
+ * order they are listed. Blank lines and lines starting with `#` are ignored.
+ * A table listed twice for the same enclosure, at the same origin, is an
+ * error rather than a second table.
+ */
+class BoxCatalog
+{
+private:
+    std::vector<Enclosure> _enclosures; ///< Enclosures in the order they first appear.
+
+public:
+    /**
+     * @brief Open and parse an enclosure catalog.
+     *
+     * @param filename Path to the catalog file.
+     * @return         The parsed catalog.
+     * @throws std::runtime_error with a user facing message if the file cannot
+     *         be opened or is not compatible.
+     */
+    static BoxCatalog open(const std::string& filename);
+
+    /**
+     * @brief Parse an enclosure catalog from a stream.
+     *
+     * @param in Stream positioned at the start of the catalog text.
+     * @return   The parsed catalog.
+     * @throws std::runtime_error with a user facing message naming the first
+     *         line that is not compatible.
+     */
+    static BoxCatalog parse(std::istream& in);
+
+    /**
+     * @brief Get every enclosure in the catalog.
+     *
+     * @return Enclosures in the order they first appear in the file.
+     */
+    const std::vector<Enclosure>& getEnclosures() const;
+
+    /**
+     * @brief Find an enclosure by name.
+     *
+     * @param name Name of the enclosure (e.g. "36x36x10").
+     * @return     Pointer to the enclosure, or nullptr if it is not in the catalog.
+     */
+    const Enclosure* find(const std::string& name) const;
+};
@@ -15,12 +15,10 @@
 #pragma once
 
 #include <iostream>
+#include <string>
 #include <vector>
 
-#include "actrans.h"
-
 #include "Device.h"
-#include "helpers.h"
 
 /**
  * @enum CableType
@@ -67,12 +65,6 @@ private:
     IOType _ioType;       ///< Input/output type the cable supports (DIGITAL or ANALOG).
     std::vector<Device> _devices; ///< Devices connected to this cable.
 
-    /**
-     * @brief Get the visual state of the cable.
-     * 
-     * @return The visual state as a wide string.
-     */
-    std::wstring _getVisState() const;
 public:
     /**
      * @brief Construct a Cable object with specified types.
@@ -83,17 +75,6 @@ public:
      */
     Cable(CableType cableType, SystemType sysType, IOType ioType);
 
-    /**
-     * @brief Draw the cable starting from a given origin.
-     * 
-     * @param origin The starting point for drawing.
-     * @param terminalNumber The number of the first terminal the cable connects to (from top to bottom).
-     * @param flip Direction of the cable. true if the cable should be drawn to the right instead of to the left, false otherwise.
-     * @param junctionTag Tag of the junction box this cable is attached to. Used for creating field tags.
-     * @param tableNumber Number indicating which table this cable is attached to (e.g., 1 for TB1).
-     */
-    void draw(AcGePoint3d origin, int terminalNumber, bool flip, const wchar_t *junctionTag, int tableNumber) const;
-
     /* ----- Setters ----- */
 
     /**
@@ -139,6 +120,13 @@ public:
      * @return The number of terminals on the cable must connect to.
      */
     int getTerminalFootprint() const;
+
+    /**
+     * @brief Get the visual state of the cable's termination blocks.
+     * 
+     * @return The visual state as a wide string (e.g., "2 Pair").
+     */
+    std::wstring getVisState() const;
     
     /* ----- Helpers ----- */
 
@@ -0,0 +1,42 @@
+/**
+ * @file CableFlip.h
+ * @brief Interface for flipping drawn cables.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "helpers.h"
+
+/**
+ * @brief Flip every cable in a selection about its junction termination.
+ *
+ * Each selected entity is opened once, inside a single transaction. The
+ * field device terminations, terminals and instrument symbols are grouped
+ * with the junction termination of their cable: the closest termination at
+ * or above them, on the side their cable is drawn on. Each cable is then
+ * mirrored with one transform about the vertical axis through its
+ * termination's insertion point, and every block's flip state (or, for
+ * terminals, X scale) is toggled.
+ *
+ * A block whose termination is not selected is mirrored about the axis its
+ * termination would have, from the block's own offset to it.
+ *
+ * @param objIds     The selected entities. Entities that are not part of a
+ *                   cable are ignored.
+ * @param cableCount Receives the number of junction terminations flipped.
+ *
+ * @return Acad::ErrorStatus indicating success or failure. Nothing is changed
+ *         if a block's name or flip state cannot be read.
+ */
+Acad::ErrorStatus flipCables(const std::vector<AcDbObjectId>& objIds, int& cableCount);
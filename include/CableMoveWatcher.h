@@ -0,0 +1,51 @@
+/**
+ * @file CableMoveWatcher.h
+ * @brief Interface for renumbering cables automatically when they are moved.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include "helpers.h"
+
+/**
+ * @brief Start renumbering the cables of a database when they are moved.
+ *
+ * A database reactor notes the position of every block reference the moment
+ * it is first opened for modification in a command, without resolving its
+ * name. When the command ends, the blocks that changed position are passed
+ * to `reindexMovedCables`, which renumbers the terminations that moved to
+ * another slot of their table. Blocks that moved within their slot, only
+ * sideways, or together with their whole table are not written.
+ *
+ * Transparent and nested commands count as part of the command they run in,
+ * so the blocks are renumbered once the outermost command ends or is
+ * cancelled. The plugin's own commands and UNDO/REDO are not watched, nor is
+ * anything they change while nested in another command.
+ *
+ * @param pDb The database to watch. Watching a new database stops watching
+ *            the previous one.
+ * @return    Acad::ErrorStatus indicating success or failure.
+ */
+Acad::ErrorStatus startCableMoveWatcher(AcDbDatabase* pDb);
+
+/**
+ * @brief Stop renumbering cables when they are moved.
+ */
+void stopCableMoveWatcher();
+
+/**
+ * @brief Check if moved cables are being renumbered.
+ *
+ * @param pDb The database.
+ * @return    true if `pDb` is being watched.
+ */
+bool isCableMoveWatcherRunning(AcDbDatabase* pDb);
@@ -0,0 +1,70 @@
+/**
+ * @file CablePrototypeCache.h
+ * @brief Interface for the CablePrototypeCache class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "helpers.h"
+
+/**
+ * @struct CablePrototype
+ * @brief The entities of the first cable drawn with a given shape.
+ */
+struct CablePrototype {
+    AcGePoint3d origin;                       ///< Origin the prototype cable was drawn at.
+    std::vector<AcDbObjectId> entities;       ///< Blocks of the cable, in the order they were inserted.
+    std::vector<AcadAttributeMap> attributes; ///< Attribute values written to each block.
+};
+
+/**
+ * @class CablePrototypeCache
+ * @brief Drawn cables that later cables of the same shape are cloned from.
+ *
+ * Two cables have the same shape when they use the same blocks with the same
+ * dynamic properties, scales and layers, and differ only in their position
+ * and attribute text. Shapes come from the groups recorded by `drawCable`.
+ *
+ * The cache holds ids of the working database, so it must be cleared at the
+ * end of the command that filled it.
+ */
+class CablePrototypeCache
+{
+private:
+    std::map<std::wstring, CablePrototype> _prototypes; ///< Prototypes by shape.
+
+public:
+    /**
+     * @brief Find the prototype of a shape.
+     *
+     * @param shape The shape of a recorded group.
+     * @return      The prototype, or nullptr if no cable of that shape was drawn yet.
+     */
+    const CablePrototype* find(const std::wstring& shape) const;
+
+    /**
+     * @brief Remember a drawn cable as the prototype of its shape.
+     *
+     * @param shape     The shape of a recorded group.
+     * @param prototype The entities of the cable.
+     */
+    void add(const std::wstring& shape, CablePrototype prototype);
+
+    /**
+     * @brief Forget every prototype.
+     */
+    void clear();
+};
@@ -0,0 +1,72 @@
+/**
+ * @file CableRecord.h
+ * @brief Interface for the records of drawn cables.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Cable.h"
+#include "LayoutPlanner.h"
+
+/// Size of a packed cable record.
+constexpr std::size_t CABLE_RECORD_SIZE = 12;
+
+/// Bytes of a packed cable record.
+typedef std::array<std::uint8_t, CABLE_RECORD_SIZE> PackedCableRecord;
+
+/**
+ * @struct CableRecord
+ * @brief What a drawn cable is, kept with the drawing so it does not have to
+ *        be worked out again from the blocks.
+ */
+struct CableRecord {
+    std::wstring junctionTag;                ///< Tag of the junction box (e.g., "IJB-810").
+    int table = 0;                           ///< Terminal table the cable is on (e.g., 1 for TB1).
+    int firstTerminal = 0;                   ///< First terminal the cable lands on.
+    int lastTerminal = 0;                    ///< Last terminal the cable takes up, gaps included.
+    CableType cableType = CableType::PAIR1;  ///< Type of the cable.
+};
+
+/**
+ * @brief Get the record of every cable of a planned junction box.
+ *
+ * @param cables      The cables, in the order they were planned.
+ * @param plan        Their placements.
+ * @param junctionTag Tag of the junction box.
+ * @return            One record per cable, in the same order.
+ */
+std::vector<CableRecord> getCableRecords(const std::vector<Cable>& cables, const LayoutPlan& plan, const std::wstring& junctionTag);
+
+/**
+ * @brief Pack the fixed size fields of a record.
+ *
+ * The bytes are a version, the cable type, the table and the terminal range,
+ * little endian, so the same record reads back on any platform. The junction
+ * tag is not packed.
+ */
+PackedCableRecord packCableRecord(const CableRecord& record);
+
+/**
+ * @brief Unpack the fixed size fields of a record.
+ *
+ * @param data   The packed bytes.
+ * @param size   Number of bytes.
+ * @param record Receives the table, terminal range and cable type.
+ * @return       false if the bytes are not a packed record of a known version.
+ */
+bool unpackCableRecord(const std::uint8_t* data, std::size_t size, CableRecord& record);
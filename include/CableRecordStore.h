@@ -0,0 +1,115 @@
+/**
+ * @file CableRecordStore.h
+ * @brief Interface for the CableRecordStore class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "CableRecord.h"
+#include "helpers.h"
+
+/**
+ * @brief Hash of an object id, for unordered containers.
+ */
+struct AcadObjectIdHash {
+    size_t operator()(const AcDbObjectId& objId) const {
+        return std::hash<long long>()(static_cast<long long>(objId.asOldId()));
+    }
+};
+
+/**
+ * @class CableRecordStore
+ * @brief The records of the cables drawn in a database.
+ *
+ * Every cable drawn by BUILDJUNCTION gets an xrecord in the `GSTCH_CABLES`
+ * dictionary of the named objects dictionary, keyed by the handle of its
+ * junction termination. The xrecord holds the packed `CableRecord` as one
+ * binary chunk (310), the junction tag (300) and a soft pointer (330) to
+ * every block of the cable. Pointers rather than packed ids are used so the
+ * members survive saving, reopening and WBLOCK.
+ *
+ * `load` reads only the member pointers of every record, so a selection can
+ * then be resolved to whole cables with one hash lookup per entity. The
+ * record fields are read and written one cable at a time.
+ */
+class CableRecordStore
+{
+private:
+    std::unordered_map<AcDbObjectId, AcDbObjectId, AcadObjectIdHash> _cables;                  ///< Record of the cable each block belongs to.
+    std::unordered_map<AcDbObjectId, std::vector<AcDbObjectId>, AcadObjectIdHash> _members;    ///< Blocks of each record.
+
+public:
+    /**
+     * @brief Record the cables of a drawn junction box.
+     *
+     * @param pDb     The database the cables were drawn in.
+     * @param records One record per cable.
+     * @param members The blocks of each cable, junction termination first. A
+     *                cable whose junction termination was not drawn is skipped.
+     * @return        Acad::ErrorStatus indicating success or failure.
+     */
+    static Acad::ErrorStatus addCables(AcDbDatabase* pDb, const std::vector<CableRecord>& records, const std::vector<std::vector<AcDbObjectId>>& members);
+
+    /**
+     * @brief Read the fields of a cable's record.
+     *
+     * @param recordId The record.
+     * @param record   Receives the fields.
+     * @return         Acad::ErrorStatus indicating success or failure.
+     */
+    static Acad::ErrorStatus readCable(const AcDbObjectId& recordId, CableRecord& record);
+
+    /**
+     * @brief Move a cable's record to a new first terminal, keeping its length.
+     *
+     * @param recordId      The record.
+     * @param firstTerminal The new first terminal.
+     * @return              Acad::ErrorStatus indicating success or failure.
+     */
+    static Acad::ErrorStatus setFirstTerminal(const AcDbObjectId& recordId, int firstTerminal);
+
+    /**
+     * @brief Read the members of every cable recorded in a database.
+     *
+     * @param pDb The database.
+     * @return    Acad::ErrorStatus indicating success or failure. A drawing
+     *            without records loads as empty.
+     */
+    Acad::ErrorStatus load(AcDbDatabase* pDb);
+
+    /**
+     * @brief Find the record of the cable a block belongs to.
+     *
+     * @param memberId A block.
+     * @return         The record, or a null id if the block is not part of a recorded cable.
+     */
+    AcDbObjectId findCable(const AcDbObjectId& memberId) const;
+
+    /**
+     * @brief Get the blocks of a recorded cable.
+     *
+     * @param recordId The record, from `findCable`.
+     * @return         The blocks, junction termination first, or an empty list.
+     */
+    const std::vector<AcDbObjectId>& getMembers(const AcDbObjectId& recordId) const;
+
+    /**
+     * @brief Add the other blocks of every recorded cable in a selection.
+     *
+     * @param objIds The selection. Blocks of recorded cables are appended once.
+     */
+    void expandToCables(std::vector<AcDbObjectId>& objIds) const;
+};
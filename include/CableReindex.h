@@ -0,0 +1,85 @@
+/**
+ * @file CableReindex.h
+ * @brief Interface for renumbering the terminals of drawn cables.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "CableRecordStore.h"
+#include "helpers.h"
+
+/**
+ * @brief Renumber the field tags of every cable in a selection.
+ *
+ * The first pass opens each selected block once and records the
+ * terminations (junction and field device, normal and 7 wire) with their
+ * height in a compact array sorted from top to bottom. The second pass
+ * works out each block's first terminal from its distance below the highest
+ * junction termination, one terminal per 0.25 units. It then rewrites the
+ * terminal number of every FLDTAG attribute in a single pass over the block's
+ * attributes.
+ *
+ * @param objIds           The selected entities. Entities that are not
+ *                         terminations are ignored.
+ * @param startingTerminal Terminal number of the highest junction termination.
+ * @param cableCount       Receives the number of junction terminations
+ *                         renumbered, 0 if none was selected.
+ * @param pRecords         Optional records of the drawing. The record of each
+ *                         renumbered cable is moved to its new terminals.
+ *
+ * @return Acad::ErrorStatus indicating success or failure.
+ */
+Acad::ErrorStatus reindexCables(const std::vector<AcDbObjectId>& objIds, int startingTerminal, int& cableCount, const CableRecordStore* pRecords = nullptr);
+
+/**
+ * @brief Renumber the field tags of every terminal table at once.
+ *
+ * Each block is opened once to read its kind, position and FLDTAG
+ * attributes. `reindexTables` groups them into tables and works out the new
+ * text of each tag, then only the blocks with changed tags are written, each
+ * in a single pass over its attributes.
+ *
+ * @param objIds     The blocks to renumber, usually every cable block in model
+ *                   space. Blocks that are not terminations are ignored.
+ * @param tableCount Receives the number of tables found.
+ * @param cableCount Receives the number of junction terminations renumbered.
+ * @param pRecords   Optional records of the drawing. The record of each
+ *                   renumbered cable is moved to its new terminals.
+ *
+ * @return Acad::ErrorStatus indicating success or failure.
+ */
+Acad::ErrorStatus reindexAllCables(const std::vector<AcDbObjectId>& objIds, int& tableCount, int& cableCount, const CableRecordStore* pRecords = nullptr);
+
+/**
+ * @brief Renumber the terminations a command moved to another slot of their table.
+ *
+ * The moved blocks are classified first, so a command that moved no
+ * termination does not read anything else. Otherwise every termination in
+ * model space is read once, and `reindexMoved` numbers each moved junction
+ * termination against the unmoved ones of its table, together with the
+ * field device termination of its record, or of the drawing if the cable was
+ * not recorded. Field device terminations moved on their own, and cables
+ * that moved together with their whole table, keep their terminals. Only the
+ * tags whose text changes are written, and the record of each renumbered
+ * cable is moved.
+ *
+ * @param pDb        The database the blocks belong to.
+ * @param movedIds   The blocks the command moved. Blocks that are not
+ *                   terminations are ignored.
+ * @param cableCount Receives the number of junction terminations renumbered.
+ * @param pRecords   Optional records of the drawing.
+ *
+ * @return Acad::ErrorStatus indicating success or failure.
+ */
+Acad::ErrorStatus reindexMovedCables(AcDbDatabase* pDb, const std::vector<AcDbObjectId>& movedIds, int& cableCount, const CableRecordStore* pRecords = nullptr);
@@ -0,0 +1,137 @@
+/**
+ * @file CableVerify.h
+ * @brief Interface for checking drawn cables against the workbook.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Cable.h"
+#include "LayoutPlanner.h"
+#include "TerminalTable.h"
+#include "Workbook.h"
+
+/**
+ * @brief Gets the planned cables of a junction by its tag, from a workbook or
+ *        anywhere else.
+ *
+ * Returns no cables for a junction it does not know, and throws
+ * std::runtime_error if the cables cannot be read.
+ */
+typedef std::function<std::vector<Cable>(const std::string& junctionTag)> CableLookup;
+
+/**
+ * @struct CableSignature
+ * @brief A cable, reduced to where it is and a hash of what it is.
+ */
+struct CableSignature {
+    std::wstring junctionTag;   ///< Tag of the junction box (e.g., "IJB-810").
+    std::wstring cableLabel;    ///< Label of the cable (e.g., "I-TT-100A"), which identifies it in its box.
+    int table = 0;              ///< Number of the terminal table.
+    int firstTerminal = 0;      ///< Terminal of its FLDTAG1.
+    std::uint64_t hash = 0;     ///< Hash of everything the drawing shows about the cable.
+};
+
+/**
+ * @enum MismatchKind
+ * @brief How a drawn cable differs from the workbook.
+ */
+enum class MismatchKind {
+    CHANGED,    ///< The cable is drawn, but not as the workbook plans it.
+    MISSING,    ///< The workbook has the cable, the drawing does not.
+    EXTRA       ///< The drawing has the cable, the workbook does not.
+};
+
+/**
+ * @struct CableMismatch
+ * @brief A cable whose drawing is stale.
+ */
+struct CableMismatch {
+    MismatchKind kind;          ///< How the cable differs.
+    CableSignature expected;    ///< The cable as planned from the workbook, empty if it is EXTRA.
+    CableSignature drawn;       ///< The cable as drawn, empty if it is MISSING.
+};
+
+/**
+ * @brief Get the signature of a cable.
+ *
+ * The hash is a 64-bit FNV-1a over the visibility state, cable label, table,
+ * first terminal, and the tag and footprint of every device in order. It
+ * only depends on those values, so signatures of the same cable from the
+ * workbook and from the drawing are equal, in any session.
+ */
+CableSignature signCable(const DrawnCable& cable);
+
+/**
+ * @brief Get the cables of a junction box as `drawJunctionBox` draws them.
+ *
+ * @param cables      The cables of the junction, already in drawing order.
+ * @param plan        Placement of every cable.
+ * @param junctionTag Tag of the junction box (e.g., "IJB-810").
+ * @return            One cable per cable, in the same order.
+ */
+std::vector<DrawnCable> getPlannedCables(const std::vector<Cable>& cables, const LayoutPlan& plan, const std::wstring& junctionTag);
+
+/**
+ * @brief Compare the planned and drawn signatures of the same junction boxes.
+ *
+ * Cables are matched by junction tag and cable label. A pair with a
+ * different hash is CHANGED, and a cable only on one side is MISSING or
+ * EXTRA. Cables whose label is used more than once are first matched by
+ * hash, then in terminal order.
+ *
+ * @return Only the mismatched cables, by junction tag then cable label.
+ */
+std::vector<CableMismatch> compareSignatures(std::vector<CableSignature> expected, std::vector<CableSignature> drawn);
+
+/**
+ * @brief Check the drawn cables of one junction box against its workbook cables.
+ *
+ * The box size a junction was drawn with is not stored in the drawing, so
+ * the cables are planned on every standard size they fit, and on a custom
+ * box, the way BUILDJUNCTION plans them. The plan with the fewest
+ * mismatches is the one reported.
+ *
+ * @param cables      The workbook cables of the junction, in any order.
+ * @param junctionTag Tag of the junction box.
+ * @param drawn       Signatures of the drawn cables of the junction box.
+ * @return            Only the mismatched cables.
+ */
+std::vector<CableMismatch> verifyJunction(std::vector<Cable> cables, const std::wstring& junctionTag, const std::vector<CableSignature>& drawn);
+
+/**
+ * @brief Check every junction box of a drawing against its planned cables.
+ *
+ * Only the junction boxes that appear in the drawing are checked, so a
+ * drawing of some of a project's boxes does not report the rest as missing.
+ *
+ * @param getCables Gets the planned cables of each drawn junction.
+ * @param table     The terminal table read from the drawing.
+ * @return          Only the mismatched cables, by junction tag then cable label.
+ * @throws std::runtime_error if the cables of a drawn junction cannot be read.
+ */
+std::vector<CableMismatch> verifyTerminalTable(const CableLookup& getCables, const TerminalTable& table);
+
+/**
+ * @brief Check every junction box of a drawing against the workbook.
+ *
+ * @param workbook The parsed workbook.
+ * @param table    The terminal table read from the drawing.
+ * @return         Only the mismatched cables, by junction tag then cable label.
+ * @throws std::runtime_error if the workbook cables of a drawn junction
+ *         cannot be read.
+ */
+std::vector<CableMismatch> verifyTerminalTable(const Workbook& workbook, const TerminalTable& table);
@@ -16,10 +16,6 @@
 
 #include <string>
 
-#include "actrans.h"
-
-#include "helpers.h"
-
 /**
  * @class Device
  * @brief Represents a device within the Junction Diagram Automation Suite.
@@ -44,14 +40,6 @@ public:
      */
     Device(std::string combinedTag, int footprint);
 
-    /**
-     * @brief Draw the device starting from a given origin.
-     * 
-     * @param origin The starting point for drawing.
-     * @param flip Direction of the device. true if the cable should be drawn to the right instead of to the left, false otherwise.
-     */
-    void draw(AcGePoint3d origin, bool flip) const;
-
     /* ----- Setters ----- */
 
     /* ----- Getters ----- */
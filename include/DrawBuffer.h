@@ -0,0 +1,198 @@
+/**
+ * @file DrawBuffer.h
+ * @brief Interface for the DrawBuffer and DrawBackend classes.
+ *
+ * Drawing a junction box records a stream of draw commands instead of
+ * changing a drawing directly. A `DrawBackend` then plays the stream into
+ * AutoCAD, a DXF file or a recording, so the drawing logic does not depend on
+ * ObjectARX and can be timed and checked on any platform.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "LayoutPlanner.h"
+
+/**
+ * @enum DrawOp
+ * @brief Kind of a draw command.
+ */
+enum class DrawOp : std::uint8_t {
+    INSERT_BLOCK,   ///< Insert a block. `name` is the block name, `x`/`y` the insertion point.
+    SET_ATTRIBUTE,  ///< Set an attribute. `name` is the tag, `text` the value.
+    SET_PROPERTY,   ///< Set a dynamic block property. `name` is the property, the value depends on `valueType`.
+    SET_LAYER,      ///< Put the block on a layer. `name` is the layer.
+    SET_SCALE,      ///< Scale the block. `x`/`y`/`z` are the scale factors.
+    BEGIN_GROUP,    ///< Start a group of blocks, such as a cable. `name` is its shape, `x`/`y` its origin.
+    END_GROUP       ///< End the current group.
+};
+
+/**
+ * @enum DrawValueType
+ * @brief Type of a dynamic block property value.
+ */
+enum class DrawValueType : std::uint8_t {
+    NONE,   ///< The command has no value.
+    SHORT,  ///< Integer value in `x`.
+    DOUBLE, ///< Real value in `x`.
+    STRING  ///< String value in `text`.
+};
+
+/**
+ * @struct DrawCommand
+ * @brief A single recorded draw command.
+ *
+ * Commands are plain data. Strings are stored once in the buffer and referred
+ * to by index, so a whole box is a single contiguous array.
+ */
+struct DrawCommand {
+    DrawOp op;                                       ///< Kind of command.
+    DrawValueType valueType = DrawValueType::NONE;   ///< Type of a SET_PROPERTY value.
+    std::uint32_t block = 0;                         ///< Block the command applies to, numbered in insertion order.
+    std::uint32_t name = 0;                          ///< String index of the block, tag, property, layer or shape name.
+    std::uint32_t text = 0;                          ///< String index of a text value.
+    double x = 0.0;                                  ///< X coordinate, X scale or numeric value.
+    double y = 0.0;                                  ///< Y coordinate or Y scale.
+    double z = 0.0;                                  ///< Z scale.
+};
+
+/**
+ * @class DrawBuffer
+ * @brief The draw commands of one or more junction boxes.
+ *
+ * Names (block names, tags, properties, layers and shapes) are interned, so
+ * each distinct name is stored once however often it is used.
+ */
+class DrawBuffer
+{
+private:
+    std::vector<DrawCommand> _commands;                      ///< Commands in the order they were recorded.
+    std::vector<std::wstring> _strings;                      ///< Names and text values.
+    std::unordered_map<std::wstring, std::uint32_t> _names;  ///< Index of each interned name.
+    std::uint32_t _blockCount = 0;                           ///< Number of INSERT_BLOCK commands.
+
+    /**
+     * @brief Get the index of a name, storing it if it is new.
+     */
+    std::uint32_t _intern(const std::wstring& name);
+
+    /**
+     * @brief Store a text value that is not expected to repeat.
+     */
+    std::uint32_t _append(const std::wstring& text);
+
+public:
+    /**
+     * @brief Record a block insertion.
+     *
+     * @param blockName The name of the block.
+     * @param origin    The insertion point.
+     * @return          The number of the new block, used by the other commands.
+     */
+    std::uint32_t insertBlock(const std::wstring& blockName, LayoutPoint origin);
+
+    /**
+     * @brief Record an attribute value.
+     */
+    void setAttribute(std::uint32_t block, const std::wstring& tag, const std::wstring& value);
+
+    /**
+     * @brief Record an integer dynamic block property (e.g. a flip state).
+     */
+    void setProperty(std::uint32_t block, const std::wstring& property, short value);
+
+    /**
+     * @brief Record a real dynamic block property (e.g. a distance).
+     */
+    void setProperty(std::uint32_t block, const std::wstring& property, double value);
+
+    /**
+     * @brief Record a string dynamic block property (e.g. a visibility state).
+     */
+    void setProperty(std::uint32_t block, const std::wstring& property, const std::wstring& value);
+
+    /**
+     * @brief Record the layer of a block.
+     */
+    void setLayer(std::uint32_t block, const std::wstring& layer);
+
+    /**
+     * @brief Record the scale factors of a block.
+     */
+    void setScale(std::uint32_t block, double x, double y, double z);
+
+    /**
+     * @brief Start a group of blocks that are drawn together.
+     *
+     * Groups with the same shape contain the same blocks with the same
+     * properties, layers and scales, and differ only in their origin and
+     * attribute text. Backends may use this to copy repeated groups.
+     *
+     * @param shape  Key that is equal for groups of the same shape.
+     * @param origin Origin of the group.
+     */
+    void beginGroup(const std::wstring& shape, LayoutPoint origin);
+
+    /**
+     * @brief End the group started by `beginGroup`.
+     */
+    void endGroup();
+
+    /**
+     * @brief Get every recorded command.
+     *
+     * @return Commands in the order they were recorded.
+     */
+    const std::vector<DrawCommand>& getCommands() const;
+
+    /**
+     * @brief Get a recorded name or text value.
+     *
+     * @param index String index from a command.
+     * @return      The string.
+     */
+    const std::wstring& getString(std::uint32_t index) const;
+
+    /**
+     * @brief Get the number of inserted blocks.
+     *
+     * @return The number of INSERT_BLOCK commands.
+     */
+    std::uint32_t getBlockCount() const;
+
+    /**
+     * @brief Remove every command and string.
+     */
+    void clear();
+};
+
+/**
+ * @class DrawBackend
+ * @brief Plays recorded draw commands into a drawing.
+ */
+class DrawBackend
+{
+public:
+    virtual ~DrawBackend() = default;
+
+    /**
+     * @brief Apply every command of a buffer.
+     *
+     * @param buffer The recorded commands.
+     */
+    virtual void execute(const DrawBuffer& buffer) = 0;
+};
@@ -0,0 +1,132 @@
+/**
+ * @file Drawing.h
+ * @brief Interface for recording the draw commands of cables and devices.
+ *
+ * The drawing logic only records commands into a `DrawBuffer`. It does not
+ * depend on ObjectARX, so it builds with the platform-neutral core and the
+ * same commands can be played into AutoCAD, a DXF file or a recording.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Cable.h"
+#include "Device.h"
+#include "DrawBuffer.h"
+#include "LayoutPlanner.h"
+
+/**
+ * @enum BlockKind
+ * @brief Which block of a cable a drawn block is.
+ */
+enum class BlockKind {
+    JUNCTION_TERM,      ///< Junction Termination.
+    JUNCTION_TERM7,     ///< Junction Termination (7 Wire).
+    FIELD_DEV_TERM,     ///< Field Device Termination.
+    FIELD_DEV_TERM7,    ///< Field Device Termination (7 Wire).
+    TB_WIRE_MINI,       ///< TBWIREMINI.
+    INST_SYMBOL,        ///< INST SYMBOL.
+    OTHER               ///< Anything else.
+};
+
+/**
+ * @brief Draw a cable starting from a given origin.
+ *
+ * The blocks of the cable are recorded as one group. Cables with the same
+ * type, visibility state, direction and device footprints get the same group
+ * shape, so a backend can copy them from the first one.
+ *
+ * @param buffer The buffer the draw commands are recorded into.
+ * @param cable The cable to draw.
+ * @param origin The starting point for drawing.
+ * @param terminalNumber The number of the first terminal the cable connects to (from top to bottom).
+ * @param flip Direction of the cable. true if the cable should be drawn to the right instead of to the left, false otherwise.
+ * @param junctionTag Tag of the junction box this cable is attached to. Used for creating field tags.
+ * @param tableNumber Number indicating which table this cable is attached to (e.g., 1 for TB1).
+ */
+void drawCable(DrawBuffer& buffer, const Cable& cable, LayoutPoint origin, int terminalNumber, bool flip, const std::wstring& junctionTag, int tableNumber);
+
+/**
+ * @brief Draw a device starting from a given origin.
+ *
+ * @param buffer The buffer the draw commands are recorded into.
+ * @param device The device to draw.
+ * @param origin The starting point for drawing.
+ * @param flip Direction of the device. true if the cable should be drawn to the right instead of to the left, false otherwise.
+ */
+void drawDevice(DrawBuffer& buffer, const Device& device, LayoutPoint origin, bool flip);
+
+/**
+ * @brief Draw every cable of a junction box.
+ *
+ * @param buffer      The buffer the draw commands are recorded into.
+ * @param cables      The cables of the box, in drawing order.
+ * @param plan        The placement of every cable, from `LayoutPlanner`.
+ * @param junctionTag Tag of the junction box.
+ */
+void drawJunctionBox(DrawBuffer& buffer, const std::vector<Cable>& cables, const LayoutPlan& plan, const std::wstring& junctionTag);
+
+/**
+ * @brief Get the cable label written to a cable's field device termination.
+ *
+ * @param cable The cable.
+ * @return      "I-" for analog or "C-" for digital cables, followed by the
+ *              first device's combined tag with its space replaced by "-"
+ *              (e.g. "I-TT-100A").
+ */
+std::wstring getCableLabel(const Cable& cable);
+
+/**
+ * @brief Get the number of field tags (FLDTAG1, FLDTAG2, ...) of a cable.
+ *
+ * @param cable The cable.
+ * @return      7 for 7-wire cables, 9 otherwise.
+ */
+int getFieldTagCount(const Cable& cable);
+
+/**
+ * @brief Get the number of field tags of a cable type.
+ *
+ * All cable types other than WIRE7 are drawn with the same blocks, so this is
+ * all that is needed for a cable that is already drawn.
+ */
+int getFieldTagCount(CableType cableType);
+
+/**
+ * @brief Get the terminal a field tag of a cable lands on.
+ *
+ * @param cable          The cable.
+ * @param terminalNumber The first terminal the cable connects to.
+ * @param fieldTag       The field tag, from 1 to `getFieldTagCount(cable)`.
+ * @return               The terminal number, skipping the gaps between the
+ *                       cable's wire groups.
+ */
+int getFieldTagTerminal(const Cable& cable, int terminalNumber, int fieldTag);
+
+/**
+ * @brief Get the terminal a field tag of a cable type lands on.
+ */
+int getFieldTagTerminal(CableType cableType, int terminalNumber, int fieldTag);
+
+/**
+ * @brief Get the name of every block the draw functions insert.
+ *
+ * @return The block names, in a fixed order.
+ */
+const std::vector<std::wstring>& getDrawingBlockNames();
+
+/**
+ * @brief Classify a block by its (dynamic) block name.
+ */
+BlockKind getBlockKind(const std::wstring& blockName);
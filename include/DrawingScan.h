@@ -0,0 +1,38 @@
+/**
+ * @file DrawingScan.h
+ * @brief Interface for reading the terminal table of an existing drawing.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "TerminalTable.h"
+#include "helpers.h"
+
+/**
+ * @brief Rebuild the terminal table of the cables drawn in a drawing.
+ *
+ * Each block is opened once, inside a single read-only transaction, and
+ * classified by its definition with a `BlockKindCache`. The blocks of cables
+ * have every attribute read in the same pass over their attribute iterator;
+ * everything else is closed without reading further. Junction terminations
+ * also have their visibility state read, which shows their cable type. The
+ * blocks are then grouped into cables and numbered by `buildTerminalTable`.
+ *
+ * @param objIds The blocks to read (e.g., every cable block in model space).
+ *               Entities that are not part of a cable are ignored.
+ * @param table  Receives the terminals of the drawing.
+ *
+ * @return Acad::ErrorStatus indicating success or failure.
+ */
+Acad::ErrorStatus scanDrawing(const std::vector<AcDbObjectId>& objIds, TerminalTable& table);
@@ -0,0 +1,140 @@
+/**
+ * @file DrawingSession.h
+ * @brief Interface for the DrawingSession class.
+ *
+ * A drawing session batches every database change made while drawing a
+ * junction box into a single transaction, so model space is opened once per
+ * box instead of once per inserted block. Block definitions, layers and cable
+ * prototypes come from caches that outlive the session.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "dbidmap.h"
+
+#include "BlockCache.h"
+#include "CablePrototypeCache.h"
+#include "helpers.h"
+
+/**
+ * @class DrawingSession
+ * @brief Holds a transaction, the block table and model space open while drawing.
+ *
+ * Block references inserted through a session belong to its transaction and
+ * are closed when the session ends. The transaction is committed when the
+ * session is destroyed.
+ */
+class DrawingSession
+{
+private:
+    BlockCache& _cache;                           ///< Block definitions and layers of the command.
+    CablePrototypeCache& _prototypes;             ///< Cable prototypes of the command.
+    bool _open = false;                           ///< true if the transaction was started.
+    AcDbDatabase* _pDb = nullptr;                 ///< The working database.
+    AcDbObjectId _modelSpaceId;                   ///< Model space.
+    AcDbBlockTableRecord* _pModelSpace = nullptr; ///< Model space, open for writing.
+
+    /**
+     * @brief Start the transaction and open model space.
+     */
+    void _begin();
+
+    /**
+     * @brief Commit the transaction, closing everything opened in it.
+     */
+    void _end();
+
+public:
+    /**
+     * @brief Start a transaction on the working database and open model space.
+     *
+     * @param cache      Block definitions and layers, shared by every session of a command.
+     * @param prototypes Cable prototypes, shared by every session of a command.
+     */
+    DrawingSession(BlockCache& cache, CablePrototypeCache& prototypes);
+
+    /**
+     * @brief Commit the transaction.
+     */
+    ~DrawingSession();
+
+    DrawingSession(const DrawingSession&) = delete;
+    DrawingSession& operator=(const DrawingSession&) = delete;
+
+    /**
+     * @brief Check if model space could be opened.
+     *
+     * @return true if blocks can be inserted, false otherwise.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Insert a block into model space.
+     *
+     * @param blockName The name of the block to be inserted.
+     * @param origin    The 3D point where the block should be placed.
+     * @return          The new block reference, open for writing until the session
+     *                  ends, or nullptr on failure.
+     */
+    AcDbBlockReference* insertBlock(const wchar_t* blockName, const AcGePoint3d& origin);
+
+    /**
+     * @brief Put an entity on a layer.
+     *
+     * @param pEnt      The entity, open for writing.
+     * @param layerName The name of the layer.
+     * @return          Acad::ErrorStatus indicating success or failure of the operation.
+     */
+    Acad::ErrorStatus setLayer(AcDbEntity* pEnt, const wchar_t* layerName);
+
+    /**
+     * @brief Set several dynamic block properties of a block reference.
+     *
+     * @param pBlkRef The block reference, open for writing.
+     * @param values  Property names and their new values, applied in order.
+     * @return        Acad::ErrorStatus indicating success or failure of the operation.
+     */
+    Acad::ErrorStatus setDynBlockProperties(AcDbBlockReference* pBlkRef, const AcadDynPropertyList& values);
+
+    /**
+     * @brief Find the prototype of a cable shape.
+     *
+     * @param shape The shape, from a recorded group.
+     * @return      The prototype, or nullptr if no cable of that shape was drawn yet.
+     */
+    const CablePrototype* findPrototype(const std::wstring& shape) const;
+
+    /**
+     * @brief Copy the entities of a prototype cable to a new origin.
+     *
+     * @param prototype   The prototype to copy.
+     * @param origin      Origin of the new cable.
+     * @param outEntities Receives the copies, open for writing until the session
+     *                    ends, in the same order as `prototype.entities`.
+     * @return            Acad::ErrorStatus indicating success or failure of the operation.
+     */
+    Acad::ErrorStatus clonePrototype(const CablePrototype& prototype, const AcGePoint3d& origin, std::vector<AcDbBlockReference*>& outEntities);
+
+    /**
+     * @brief Remember a drawn cable as the prototype of its shape.
+     *
+     * The transaction stays open: later cables of the box are cloned from the
+     * prototype's entities inside it, so a box is never committed partway.
+     *
+     * @param shape     The shape, from a recorded group.
+     * @param prototype The entities of the cable.
+     */
+    void addPrototype(const std::wstring& shape, CablePrototype prototype);
+};
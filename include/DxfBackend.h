@@ -0,0 +1,131 @@
+/**
+ * @file DxfBackend.h
+ * @brief Interface for the DxfBackend class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "DrawBuffer.h"
+
+/**
+ * @struct DxfAttributeDefinition
+ * @brief Where a block definition places the text of one attribute.
+ */
+struct DxfAttributeDefinition {
+    std::wstring tag;       ///< Tag of the attribute (e.g., "FLDTAG1").
+    double x = 0.0;         ///< X of the text point, from the base point of the block.
+    double y = 0.0;         ///< Y of the text point, from the base point of the block.
+    double alignX = 0.0;    ///< X of the alignment point, from the base point of the block.
+    double alignY = 0.0;    ///< Y of the alignment point, from the base point of the block.
+    double height = 0.0;    ///< Text height.
+    double rotation = 0.0;  ///< Text rotation, in degrees.
+    int flags = 0;          ///< Attribute flags (1 for invisible).
+    int horizontal = 0;     ///< Horizontal justification (0 left, 1 center, 2 right).
+    int vertical = 0;       ///< Vertical justification (0 baseline, 1 bottom, 2 middle, 3 top).
+};
+
+/// Attribute definitions by block name.
+typedef std::map<std::wstring, std::vector<DxfAttributeDefinition>> DxfBlockTemplates;
+
+/**
+ * @brief Read the attribute definitions of every block of an ASCII DXF file.
+ *
+ * Only the ATTDEF entities of the BLOCKS section are read, with their
+ * positions made relative to the base point of their block. A block library
+ * saved as DXF from the drawing template gives the real positions.
+ *
+ * @param in The DXF file.
+ * @return   The attribute definitions, by block name.
+ * @throws std::runtime_error if the file ends in the middle of a group.
+ */
+DxfBlockTemplates readDxfBlockTemplates(std::istream& in);
+
+/**
+ * @class DxfBackend
+ * @brief Writes recorded draw commands to an ASCII DXF file.
+ *
+ * The file header and block table are written on construction, each call to
+ * `execute` appends the blocks of one buffer to the ENTITIES section, and
+ * `finish` closes the file. Only the buffer being played and its text are held
+ * in memory, so a whole project can be written one box at a time.
+ *
+ * Every block is written as an INSERT with its layer and scale factors, at
+ * the same insertion point the AutoCAD backend uses. A DXF has no dynamic
+ * block properties, so those are attached to the INSERT as extended data of
+ * the `JUNCTION_DYN` application, one name/value pair per property.
+ *
+ * Attributes are only written for blocks with templates. Each ATTRIB is
+ * placed at the insertion point plus its definition's offset, scaled and
+ * mirrored with the block, with the definition's height and flags, so hidden
+ * tags stay hidden. A mirrored block swaps left and right justification so
+ * the text still reads left to right. Positions that depend on dynamic block
+ * properties are those of the definition's default state. Attributes without
+ * a definition are not written, since they would all stack on the insertion
+ * point.
+ *
+ * The block definitions only contain the templates' attribute definitions;
+ * they are replaced by the real blocks when the file is inserted into a
+ * drawing that already contains them, or redefined from the block library.
+ */
+class DxfBackend : public DrawBackend
+{
+private:
+    std::ostream& _out;                   ///< Where the file is written.
+    std::vector<std::wstring> _blocks;    ///< Names of the blocks declared in the block table.
+    DxfBlockTemplates _templates;         ///< Attribute definitions of the blocks, by block name.
+    std::string _text;                    ///< Text of the box being written, flushed at the end of `execute`.
+    bool _finished = false;               ///< true once the file has been closed.
+
+    /**
+     * @brief Write the header, tables and block definitions.
+     */
+    void _begin();
+
+public:
+    /**
+     * @brief Start a DXF file.
+     *
+     * @param out        Stream the file is written to. It must outlive the backend.
+     * @param blockNames Every block name the buffers may insert (e.g. from
+     *                   `getDrawingBlockNames`).
+     * @param templates  Attribute definitions of the blocks (e.g. from
+     *                   `readDxfBlockTemplates`). Without them no attribute
+     *                   is written.
+     */
+    DxfBackend(std::ostream& out, const std::vector<std::wstring>& blockNames, DxfBlockTemplates templates = DxfBlockTemplates());
+
+    /**
+     * @brief Close the file if `finish` was not called.
+     */
+    ~DxfBackend() override;
+
+    /**
+     * @brief Append the blocks of a buffer to the file.
+     *
+     * @param buffer The recorded commands.
+     * @throws std::invalid_argument if the buffer inserts a block that was not
+     *         declared when the backend was constructed.
+     * @throws std::logic_error if the file was already closed.
+     */
+    void execute(const DrawBuffer& buffer) override;
+
+    /**
+     * @brief Close the ENTITIES section and end the file.
+     */
+    void finish();
+};
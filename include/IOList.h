@@ -0,0 +1,69 @@
+/**
+ * @file IOList.h
+ * @brief Interface for the IOList class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+/**
+ * @struct IOListEntry
+ * @brief The columns of a single "IO List" row that describe a device.
+ */
+struct IOListEntry {
+    std::string instrumentSpec; ///< Instrument specification (column 5, e.g. "RTD").
+    std::string ioType;         ///< IO type cell (column 7, e.g. "AI" or "DO").
+    std::string systemType;     ///< System type cell (column 8, e.g. "Safety").
+};
+
+/**
+ * @class IOList
+ * @brief Hash-indexed view of the "IO List" worksheet.
+ *
+ * The worksheet is read once and every row is keyed by its combined device tag
+ * (e.g. "TT 100A"), so that resolving a device from the Cable Schedule is a
+ * single lookup instead of a scan over the whole sheet.
+ */
+class IOList
+{
+private:
+    std::unordered_map<std::string, IOListEntry> _entries; ///< Rows keyed by combined device tag.
+
+public:
+    /**
+     * @brief Add a row to the index.
+     *
+     * If the combined tag is already present the existing row is kept, matching
+     * a top-down scan of the sheet that stops on the first match.
+     *
+     * @param combinedTag Combined tag and number of the device (e.g. "TT 100A").
+     * @param entry       The columns of the row describing the device.
+     */
+    void add(const std::string& combinedTag, IOListEntry entry);
+
+    /**
+     * @brief Find the row describing a device.
+     *
+     * @param combinedTag Combined tag and number of the device (e.g. "TT 100A").
+     * @return            Pointer to the row, or nullptr if the device is not listed.
+     */
+    const IOListEntry* find(const std::string& combinedTag) const;
+
+    /**
+     * @brief Get the number of devices in the index.
+     *
+     * @return The number of unique combined tags read from the worksheet.
+     */
+    size_t size() const;
+};
@@ -16,6 +16,7 @@
 
 #define NOMINMAX // makes std::numeric_limits<int>::max() work
 
+#include <fstream>
 #include <set>
 #include <string>
 #include <limits> // for std::numeric_limits
@@ -26,10 +27,19 @@
 
 #include "acedads.h"
 
-#include "OpenXLSX.hpp"
-
+#include "ArxDrawBackend.h"
+#include "BoxCatalog.h"
+#include "CableFlip.h"
+#include "CableMoveWatcher.h"
+#include "CableReindex.h"
 #include "Cable.h"
+#include "CableRecordStore.h"
+#include "CableVerify.h"
 #include "Device.h"
+#include "Drawing.h"
+#include "DrawingScan.h"
+#include "LayoutPlanner.h"
+#include "Workbook.h"
 #include "resource.h"
 
 /**
@@ -63,4 +73,47 @@ void flipCable();
  * of each cable to match the respective terminal blocks they attach to, assuming proper
  * spacing.
  */
-void reIndexCable();
\ No newline at end of file
+void reIndexCable();
+
+/**
+ * @brief Change the terminal index of every cable in the drawing.
+ *
+ * This function finds every cable in model space, groups them into terminal tables
+ * and renumbers each table from terminal 1 at its top wire.
+ */
+void reIndexAll();
+
+/**
+ * @brief Turn automatic re-indexing of moved cables on or off.
+ *
+ * While it is on, cables whose junction termination is moved up or down are
+ * re-indexed when the command that moved them ends.
+ */
+void autoReindex();
+
+/**
+ * @brief Write the terminal table of the drawing to a CSV file.
+ *
+ * This function reads every cable in model space back into junction boxes, terminal
+ * tables, terminals and devices, and asks the user where to save them, one row per
+ * terminal.
+ */
+void exportTerminals();
+
+/**
+ * @brief Check the junction boxes of the drawing against an IO list.
+ *
+ * This function asks the user for the revised `.xlsx` file, reads every cable in model
+ * space back from the drawing, and lists only the cables whose drawing no longer matches
+ * the workbook.
+ */
+void verifyDrawing();
+
+/**
+ * @brief Show how many database objects the plugin opened and closed.
+ *
+ * This function prints the counts of `acadGetOpenCounter` since they were last
+ * shown, then resets them, so running it before and after a command measures that
+ * command.
+ */
+void openCounts();
@@ -0,0 +1,206 @@
+/**
+ * @file LayoutPlanner.h
+ * @brief Interface for the LayoutPlan, LayoutPlanner and FitEvaluator classes.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "BoxCatalog.h"
+#include "Cable.h"
+
+/**
+ * @struct LayoutPoint
+ * @brief A point in drawing coordinates.
+ */
+struct LayoutPoint {
+    double x = 0.0; ///< X coordinate.
+    double y = 0.0; ///< Y coordinate.
+};
+
+/**
+ * @struct CablePlacement
+ * @brief Where a single cable is drawn.
+ */
+struct CablePlacement {
+    int table;          ///< Terminal table the cable is placed on (e.g., 1 for TB1).
+    int terminal;       ///< First terminal of the table the cable connects to.
+    bool flip;          ///< true if the cable is drawn to the right instead of to the left.
+    LayoutPoint origin; ///< Insertion point of the cable's junction termination block.
+};
+
+/**
+ * @class LayoutPlan
+ * @brief The placement of every cable of a junction box.
+ *
+ * A plan is produced by `LayoutPlanner` and cannot be modified afterwards.
+ * Placements are in the same order as the cables that were planned.
+ */
+class LayoutPlan
+{
+private:
+    std::vector<CablePlacement> _placements; ///< Placement of each cable, in cable order.
+    int _footprint = 0;                      ///< Total number of terminals used by the cables.
+    int _overflowIndex = -1;                 ///< Index of the first cable that runs off its table, or -1.
+
+    friend class LayoutPlanner;
+
+    LayoutPlan() = default;
+
+public:
+    /**
+     * @brief Get the placement of every cable.
+     *
+     * @return Placements in the same order as the planned cables.
+     */
+    const std::vector<CablePlacement>& getPlacements() const;
+
+    /**
+     * @brief Get the total number of terminals used by the cables.
+     *
+     * @return The sum of every cable's terminal footprint.
+     */
+    int getFootprint() const;
+
+    /**
+     * @brief Check if any cable runs off the end of its table.
+     *
+     * @return true if the cables do not fit in the box, false otherwise.
+     */
+    bool overflows() const;
+
+    /**
+     * @brief Get the first cable that runs off the end of its table.
+     *
+     * @return Index of the cable, or -1 if every cable fits.
+     */
+    int getOverflowIndex() const;
+
+    /**
+     * @brief Get the number of placed cables.
+     *
+     * @return The number of cables that were planned.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Access the placement of a cable.
+     *
+     * @param index Index of the cable in the planned cable list.
+     * @return      The placement of the cable.
+     */
+    const CablePlacement& operator[](size_t index) const;
+};
+
+/**
+ * @class LayoutPlanner
+ * @brief Places sorted cables on the terminal tables of a junction box.
+ *
+ * The planner computes the terminal footprint of every cable once and keeps
+ * running sums of them, so deciding whether the remaining cables fit on the
+ * following tables is a constant-time check and planning a box is linear in
+ * the number of cables.
+ *
+ * Cables fill the tables in order. A cable moves on to the next table once
+ * the rest of the cables fit on the tables after the current one and either
+ * the safety cables start or the current table is full.
+ *
+ * The standard sizes are planned from the constexpr `BoxSpec`s, so their
+ * planning loops are specialized for their table count at compile time.
+ */
+class LayoutPlanner
+{
+private:
+    BoxSize _boxSize;               ///< Size of the box being planned, CUSTOM for run-time enclosures.
+    std::vector<TableSpec> _tables; ///< Tables of a CUSTOM box or run-time enclosure.
+
+    /**
+     * @brief Place every cable on a set of tables.
+     *
+     * @param tables Either a `std::array<TableSpec, N>` or a `std::vector<TableSpec>`.
+     * @param cables The cables of the junction, already in drawing order.
+     * @return       The placement of every cable.
+     */
+    template <typename Tables>
+    static LayoutPlan _plan(const Tables& tables, const std::vector<Cable>& cables);
+
+public:
+    /**
+     * @brief Construct a planner for a box size.
+     *
+     * @param boxSize Size of the box.
+     * @param origin  Origin used for a CUSTOM box, which has a single table with
+     *                no terminal limit. The standard sizes always start at the
+     *                first terminal of their template.
+     */
+    LayoutPlanner(BoxSize boxSize, LayoutPoint origin = LayoutPoint());
+
+    /**
+     * @brief Construct a planner for an enclosure loaded at run time.
+     *
+     * @param enclosure The enclosure and its terminal tables.
+     */
+    LayoutPlanner(const Enclosure& enclosure);
+
+    /**
+     * @brief Place every cable of a junction box.
+     *
+     * @param cables The cables of the junction, already in drawing order.
+     * @return       The placement of every cable.
+     */
+    LayoutPlan plan(const std::vector<Cable>& cables) const;
+};
+
+/**
+ * @struct BoxFit
+ * @brief How well a set of cables fits in a box size.
+ */
+struct BoxFit {
+    BoxSize boxSize;            ///< Size of the box, CUSTOM for run-time enclosures.
+    std::string name;           ///< Name of the enclosure (e.g. "24x24x8").
+    int capacity;               ///< Total number of terminals in the box.
+    int footprint;              ///< Total number of terminals used by the cables.
+    int spare;                  ///< Unused terminals, negative if the cables do not fit.
+    std::vector<int> tableFill; ///< Terminals used on each table.
+    int overflowIndex;          ///< Index of the first cable that runs off its table, or -1.
+};
+
+/**
+ * @class FitEvaluator
+ * @brief Scores box sizes for a set of cables.
+ *
+ * All sizes are evaluated together in a single pass over the cables, using
+ * the same table split rules as `LayoutPlanner`.
+ */
+class FitEvaluator
+{
+public:
+    /**
+     * @brief Evaluate how the cables fit in each standard box size.
+     *
+     * @param cables The cables of the junction.
+     * @return       One fit for each of SMALL, MEDIUM and LARGE, indexed by `BoxSize`.
+     */
+    static std::vector<BoxFit> evaluate(const std::vector<Cable>& cables);
+
+    /**
+     * @brief Evaluate how the cables fit in each of a set of enclosures.
+     *
+     * @param cables     The cables of the junction.
+     * @param enclosures The enclosures to evaluate.
+     * @return           One fit for each enclosure, in the same order.
+     */
+    static std::vector<BoxFit> evaluate(const std::vector<Cable>& cables, const std::vector<Enclosure>& enclosures);
+};
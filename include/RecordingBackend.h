@@ -0,0 +1,60 @@
+/**
+ * @file RecordingBackend.h
+ * @brief Interface for the RecordingBackend class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <ostream>
+
+#include "DrawBuffer.h"
+
+/**
+ * @class RecordingBackend
+ * @brief Counts draw commands and optionally writes them out as text.
+ *
+ * The transcript has one line per command with coordinates rounded to four
+ * decimals, so the same cables always produce the same text. It can be
+ * compared against a known good transcript to check a change to the drawing
+ * logic without AutoCAD.
+ */
+class RecordingBackend : public DrawBackend
+{
+private:
+    std::ostream* _pOut = nullptr;                ///< Where the transcript is written, or nullptr.
+    std::array<std::size_t, 7> _counts{};         ///< Number of commands of each `DrawOp`.
+
+public:
+    /**
+     * @brief Construct a backend that only counts commands.
+     */
+    RecordingBackend() = default;
+
+    /**
+     * @brief Construct a backend that also writes a transcript.
+     *
+     * @param out Stream the transcript is written to.
+     */
+    explicit RecordingBackend(std::ostream& out);
+
+    void execute(const DrawBuffer& buffer) override;
+
+    /**
+     * @brief Get the number of commands of a kind played so far.
+     *
+     * @param op The kind of command.
+     * @return   The number of commands.
+     */
+    std::size_t getCount(DrawOp op) const;
+};
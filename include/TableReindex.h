@@ -0,0 +1,118 @@
+/**
+ * @file TableReindex.h
+ * @brief Interface for renumbering every terminal table of a drawing.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Drawing.h"
+
+constexpr size_t UNRECORDED_BLOCK = static_cast<size_t>(-1); ///< Index of a block that was not recorded.
+
+/**
+ * @struct ReindexBlock
+ * @brief A drawn block, as read from the drawing.
+ */
+struct ReindexBlock {
+    BlockKind kind = BlockKind::OTHER;  ///< Which block of a cable it is.
+    double x = 0.0;                     ///< X coordinate of the insertion point.
+    double y = 0.0;                     ///< Y coordinate of the insertion point.
+    std::vector<std::wstring> fieldTags; ///< Text of FLDTAG1, FLDTAG2, ... in order, empty if a tag is missing.
+};
+
+/**
+ * @struct ReindexTable
+ * @brief A terminal table found in the drawing.
+ */
+struct ReindexTable {
+    std::wstring prefix;                ///< Field tag text before the terminal number (e.g., "IJB-810-TB1").
+    double left = 0.0;                  ///< Smallest X of its junction terminations.
+    double right = 0.0;                 ///< Largest X of its junction terminations.
+    double top = 0.0;                   ///< Y of its highest junction termination, which lands on terminal 1.
+    std::vector<size_t> terminations;   ///< Its junction terminations, top to bottom.
+};
+
+/**
+ * @struct FieldTagUpdate
+ * @brief New text for one field tag.
+ */
+struct FieldTagUpdate {
+    size_t block;       ///< Index of the block.
+    int fieldTag;       ///< Number of the field tag (1 for FLDTAG1).
+    std::wstring text;  ///< New text of the tag.
+};
+
+/**
+ * @struct ReindexResult
+ * @brief The tables of a drawing and the field tags that change.
+ */
+struct ReindexResult {
+    std::vector<ReindexTable> tables;       ///< Every table, by prefix then from left to right.
+    std::vector<FieldTagUpdate> updates;    ///< Changed tags, by block then by field tag.
+    std::vector<int> firstTerminals;        ///< Terminal of FLDTAG1 of each block, 0 if it was not numbered.
+    size_t cableCount = 0;                  ///< Number of junction terminations renumbered.
+    size_t unmatchedCount = 0;              ///< Field device terminations whose table was not found.
+};
+
+/**
+ * @brief Renumber the field tags of every terminal table in a drawing.
+ *
+ * Junction terminations are grouped into tables by the field tag text before
+ * the terminal number, then split into columns wherever their X positions are
+ * more than half a unit apart. The highest junction termination of a table
+ * lands on terminal 1, and every other one on the terminal its distance below
+ * it gives, one terminal per 0.25 units, with the wire gaps of
+ * `getFieldTagTerminal`.
+ *
+ * A field device termination is drawn 9 units to either side of its junction
+ * termination with the same field tags, so it is numbered with the table of
+ * the same prefix whose column is 9 units away.
+ *
+ * The function only reads its input, so it can run without AutoCAD.
+ *
+ * @param blocks Every block of the drawing. Blocks other than terminations,
+ *               and terminations without a numbered field tag, are ignored.
+ * @return       The tables and the field tags whose text changes.
+ */
+ReindexResult reindexTables(const std::vector<ReindexBlock>& blocks);
+
+/**
+ * @brief Renumber the cables a command moved to another slot of their table.
+ *
+ * A moved junction termination is numbered against the closest unmoved
+ * junction termination of the same prefix in its column: it lands on that
+ * termination's terminal plus one terminal per 0.25 units below it. A
+ * termination whose column has no unmoved termination moved together with
+ * the rest of its table, so its terminals do not change.
+ *
+ * Field device terminations are only numbered with their cable's junction
+ * termination, to the same terminals, whether they moved or not. A field
+ * device termination moved on its own keeps its tags. The field device
+ * termination of a cable is the one in `fieldDevices`, or for cables without
+ * one, the field device termination about 9 units to either side whose
+ * FLDTAG1 is the same as the junction termination's, closest in height.
+ *
+ * The function only reads its input, so it can run without AutoCAD.
+ *
+ * @param blocks       Every termination of the drawing, where the command left it.
+ * @param moved        Whether the command moved each block, in the same order.
+ * @param fieldDevices Index of the recorded field device termination of each
+ *                     junction termination, or UNRECORDED_BLOCK. May be empty
+ *                     if no cable is recorded.
+ * @return             The field tags whose text changes, and the terminal of
+ *                     FLDTAG1 of each renumbered block. `tables` is left empty.
+ */
+ReindexResult reindexMoved(const std::vector<ReindexBlock>& blocks, const std::vector<bool>& moved, const std::vector<size_t>& fieldDevices = {});
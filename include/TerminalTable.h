@@ -0,0 +1,112 @@
+/**
+ * @file TerminalTable.h
+ * @brief Interface for rebuilding the terminal table of a drawing.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Drawing.h"
+#include "LayoutPlanner.h"
+
+/**
+ * @struct ScanBlock
+ * @brief A drawn block and its attributes, as read from the drawing.
+ */
+struct ScanBlock {
+    BlockKind kind = BlockKind::OTHER;  ///< Which block of a cable it is.
+    double x = 0.0;                     ///< X coordinate of the insertion point.
+    double y = 0.0;                     ///< Y coordinate of the insertion point.
+    std::wstring visibility;            ///< Visibility1 of a junction termination, empty for other blocks.
+    std::vector<std::pair<std::wstring, std::wstring>> attributes; ///< Tag and text of every attribute, in block order.
+};
+
+/**
+ * @struct TerminalRow
+ * @brief One terminal of a junction box and the device wired to it.
+ */
+struct TerminalRow {
+    std::wstring junctionTag;   ///< Tag of the junction box (e.g., "IJB-810").
+    int table = 0;              ///< Number of the terminal table.
+    int terminal = 0;           ///< Number of the terminal in its table.
+    std::wstring cableLabel;    ///< Label of the cable (CL of its field device termination).
+    std::wstring deviceTag;     ///< Tag and number of the device (e.g., "SDV 60A").
+    std::wstring wire;          ///< Label of the device terminal (e.g., "+", "REF", "5").
+};
+
+/**
+ * @struct DrawnCable
+ * @brief One cable of a junction box, as drawn.
+ */
+struct DrawnCable {
+    std::wstring junctionTag;   ///< Tag of the junction box (e.g., "IJB-810").
+    int table = 0;              ///< Number of the terminal table.
+    int firstTerminal = 0;      ///< Terminal of its FLDTAG1.
+    std::wstring cableLabel;    ///< Label of the cable (CL of its field device termination).
+    std::wstring visibility;    ///< Visibility state of its junction termination (e.g., "1 Pair").
+    std::vector<std::pair<std::wstring, int>> devices; ///< Tag and terminal footprint of each device, top to bottom.
+};
+
+/**
+ * @struct TerminalTable
+ * @brief The terminals of a drawing and how well its blocks were grouped.
+ */
+struct TerminalTable {
+    std::vector<TerminalRow> rows;  ///< Every terminal, by junction tag, table, then terminal.
+    std::vector<DrawnCable> cables; ///< Every numbered cable, by junction tag, table, then first terminal.
+    size_t unnumberedCount = 0;     ///< Junction terminations without a numbered FLDTAG1.
+    size_t unmatchedCount = 0;      ///< Cable blocks whose junction termination was not found.
+};
+
+/**
+ * @brief Rebuild the terminal table of a drawing from its blocks.
+ *
+ * Every block of a cable is drawn a fixed distance to one side of its
+ * junction termination: the field device termination 9 units, the terminals
+ * 9.3438 units and the instrument symbols 9.9375 units away, from 0.125
+ * units above the termination downwards. The junction terminations are
+ * bucketed by their axis on a grid, so each block finds its cable by looking
+ * up the few cells above it on either possible axis and taking the closest
+ * termination that is not below it.
+ *
+ * The terminals of a cable are numbered from the terminal of its FLDTAG1,
+ * one per 0.25 units below the termination. A new device starts at each
+ * terminal labelled "+" or "L", and its tag is taken from the cable's
+ * instrument symbols in the same top to bottom order. Its footprint follows
+ * from the labels `drawDevice` gives its terminals: 6 terminals for "L", 4
+ * for "REF" and 3 otherwise.
+ *
+ * The function only reads its input, so it can run without AutoCAD.
+ *
+ * @param blocks Every block of the drawing. Blocks that are not part of a
+ *               cable are ignored.
+ * @return       The terminals and the number of blocks that did not fit.
+ */
+TerminalTable buildTerminalTable(const std::vector<ScanBlock>& blocks);
+
+/**
+ * @brief Get the terminals of a planned junction box without drawing it.
+ *
+ * These are the rows `buildTerminalTable` reads back once the box is drawn:
+ * one per device terminal, with the labels `drawDevice` gives them ("+", "-"
+ * and "REF", or "L", "N", "5" and "6" for a 2 pair device).
+ *
+ * @param cables      The cables, in the order they were planned.
+ * @param plan        Their placements.
+ * @param junctionTag Tag of the junction box.
+ * @return            Every terminal, by table and then terminal.
+ */
+std::vector<TerminalRow> getTerminalRows(const std::vector<Cable>& cables, const LayoutPlan& plan, const std::wstring& junctionTag);
@@ -0,0 +1,157 @@
+/**
+ * @file Workbook.h
+ * @brief Interface for the Workbook and WorkbookCache classes.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Cable.h"
+#include "Device.h"
+#include "IOList.h"
+
+/**
+ * @struct CableScheduleRow
+ * @brief The columns of a single "Cable Schedule Data" row.
+ */
+struct CableScheduleRow {
+    bool newCable;           ///< true if column 1 holds a cable quantity, starting a new cable.
+    std::string quantity;    ///< Cable quantity (column 1, e.g. "1 Pair"). Empty unless `newCable`.
+    std::string junctionTag; ///< Junction the device terminates in (column 3, e.g. "IJB-810").
+    std::string combinedTag; ///< Combined tag of the device (column 4, e.g. "TT 100A").
+};
+
+/**
+ * @struct Junction
+ * @brief The cables of a single junction box, as listed in the Cable Schedule.
+ */
+struct Junction {
+    std::string tag;           ///< Junction tag (e.g. "IJB-810").
+    std::vector<Cable> cables; ///< Cables terminating in the junction, in sheet order.
+    std::string error;         ///< User facing error if the junction's rows are not compatible, empty otherwise.
+};
+
+/**
+ * @class Workbook
+ * @brief The parsed contents of an IO list workbook.
+ *
+ * Holds the rows of the "Cable Schedule Data" worksheet, an index of the
+ * "IO List" worksheet, and the cables of every junction. The Cable Schedule is
+ * partitioned by junction tag in a single pass when the workbook is opened, so
+ * looking up the cables of any junction does not touch the sheet again.
+ */
+class Workbook
+{
+private:
+    std::vector<CableScheduleRow> _cableSchedule;           ///< Rows of "Cable Schedule Data", in sheet order.
+    IOList _ioList;                                         ///< Index of "IO List".
+    std::vector<Junction> _junctions;                       ///< Every junction, in the order it first appears.
+    std::unordered_map<std::string, size_t> _junctionIndex; ///< Index into `_junctions` by junction tag.
+
+    /**
+     * @brief Bucket the Cable Schedule rows by junction tag and build each
+     *        junction's cables.
+     *
+     * A junction whose rows are not compatible keeps no cables and records
+     * the reason in `Junction::error`; the other junctions are unaffected.
+     */
+    void _partition();
+
+public:
+    /**
+     * @brief Open and parse a workbook.
+     *
+     * @param filename Absolute path to the Excel (.xlsx) file.
+     * @return         The parsed workbook.
+     * @throws std::runtime_error with a user facing message if the file cannot
+     *         be opened or is not compatible.
+     */
+    static std::shared_ptr<const Workbook> open(const std::string& filename);
+
+    /**
+     * @brief Get the list of `Cable` objects for a junction tag.
+     *
+     * @param junctionTag Tag (e.g. "IJB-810") identifying the junction whose
+     *                    cables should be extracted.
+     * @return            Vector of fully-populated `Cable` objects, in sheet order.
+     * @throws std::runtime_error with a user facing message if a device is
+     *         missing from the IO List or its row is not compatible.
+     */
+    std::vector<Cable> getCables(const std::string& junctionTag) const;
+
+    /**
+     * @brief Collect all unique junction tags found in the Cable Schedule.
+     *
+     * @return Unique tags in the order they first appear, excluding "N/A".
+     */
+    std::vector<std::string> getJunctionTags() const;
+
+    /**
+     * @brief Get every junction in the Cable Schedule.
+     *
+     * @return Every junction, including "N/A", in the order it first appears.
+     */
+    const std::vector<Junction>& getJunctions() const;
+
+    /**
+     * @brief Get the rows of the Cable Schedule.
+     *
+     * @return Every row read from "Cable Schedule Data", in sheet order.
+     */
+    const std::vector<CableScheduleRow>& getCableSchedule() const;
+
+    /**
+     * @brief Get the IO List index.
+     *
+     * @return The index of "IO List".
+     */
+    const IOList& getIOList() const;
+};
+
+/**
+ * @class WorkbookCache
+ * @brief Keeps the last parsed workbook for the duration of a command.
+ *
+ * The cached workbook is reused for as long as the path, file size and
+ * modification time of the file are unchanged. Saving the workbook in Excel
+ * while the dialog is open causes it to be parsed again on the next request.
+ */
+class WorkbookCache
+{
+private:
+    std::string _filename;                        ///< Path of the cached workbook.
+    std::uintmax_t _fileSize = 0;                 ///< Size of the file when it was parsed.
+    std::filesystem::file_time_type _modified;    ///< Modification time of the file when it was parsed.
+    std::shared_ptr<const Workbook> _workbook;    ///< The parsed workbook, or nullptr if empty.
+
+public:
+    /**
+     * @brief Get a parsed workbook, parsing the file only if it is not cached.
+     *
+     * @param filename Absolute path to the Excel (.xlsx) file.
+     * @return         The parsed workbook.
+     * @throws std::runtime_error with a user facing message if the file cannot
+     *         be opened or is not compatible.
+     */
+    std::shared_ptr<const Workbook> get(const std::string& filename);
+
+    /**
+     * @brief Release the cached workbook.
+     */
+    void clear();
+};
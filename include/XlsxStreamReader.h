@@ -0,0 +1,128 @@
+/**
+ * @file XlsxStreamReader.h
+ * @brief Interface for the XlsxStreamReader class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @struct XlsxCell
+ * @brief The value of a single worksheet cell.
+ */
+struct XlsxCell {
+    std::string value;     ///< Text of the cell as stored in the workbook. Empty if the cell is empty.
+    bool isString = false; ///< true if the cell holds a string, false for numbers, booleans, errors and empty cells.
+};
+
+/**
+ * @brief The requested columns of one worksheet row, in the order they were requested.
+ */
+using XlsxRow = std::vector<XlsxCell>;
+
+/**
+ * @brief Consecutive rows read from a worksheet, starting at the query's first row.
+ */
+using XlsxTable = std::vector<XlsxRow>;
+
+/**
+ * @struct XlsxSheetQuery
+ * @brief Describes which part of a worksheet should be read.
+ */
+struct XlsxSheetQuery {
+    std::string sheetName;         ///< Name of the worksheet (e.g. "IO List").
+    uint32_t firstRow;             ///< First row to read (1 based).
+    std::vector<uint16_t> columns; ///< Columns to read (1 based). All other columns are skipped.
+    uint16_t stopColumn;           ///< Reading stops at the first row where this column is empty. Must be in `columns`.
+};
+
+/**
+ * @class XlsxStreamReader
+ * @brief Forward-only reader for the few worksheet columns the suite uses.
+ *
+ * Worksheets are inflated and scanned straight from the .xlsx archive without
+ * building a document tree. Only the requested columns are kept, and only the
+ * shared strings those columns reference are ever materialised, so memory use
+ * is proportional to the data returned rather than the size of the workbook.
+ */
+class XlsxStreamReader
+{
+private:
+    /**
+     * @struct _ZipEntry
+     * @brief Location of a compressed part inside the archive.
+     */
+    struct _ZipEntry {
+        uint16_t method;            ///< Compression method (0 = stored, 8 = deflate).
+        uint32_t compressedSize;    ///< Size of the compressed data in bytes.
+        uint32_t uncompressedSize;  ///< Size of the inflated data in bytes.
+        uint32_t localHeaderOffset; ///< Offset of the part's local file header.
+    };
+
+    std::ifstream _file;                                      ///< The open archive.
+    std::unordered_map<std::string, _ZipEntry> _entries;      ///< Archive parts by path (e.g. "xl/workbook.xml").
+    std::unordered_map<std::string, std::string> _sheetParts; ///< Archive part of each worksheet by sheet name.
+    std::string _sharedStringsPart;                           ///< Archive part of the shared string table, empty if there is none.
+
+    /**
+     * @brief Read the archive's central directory into `_entries`.
+     */
+    void _readCentralDirectory();
+
+    /**
+     * @brief Resolve the archive part of every worksheet and of the shared string table.
+     */
+    void _readWorkbook();
+
+    /**
+     * @brief Find a part in the archive.
+     *
+     * @param path Path of the part (e.g. "xl/workbook.xml").
+     * @return     The part's location.
+     * @throws std::runtime_error if the part does not exist.
+     */
+    const _ZipEntry& _entry(const std::string& path) const;
+
+public:
+    /**
+     * @brief Open a workbook and read its directory of worksheets.
+     *
+     * @param filename Path to the Excel (.xlsx) file.
+     * @throws std::runtime_error if the file cannot be opened or is not a workbook.
+     */
+    explicit XlsxStreamReader(const std::string& filename);
+
+    /**
+     * @brief Check whether the workbook contains a worksheet.
+     *
+     * @param sheetName Name of the worksheet (e.g. "IO List").
+     * @return          true if the worksheet exists, false otherwise.
+     */
+    bool hasSheet(const std::string& sheetName) const;
+
+    /**
+     * @brief Read the requested columns of one or more worksheets.
+     *
+     * Each worksheet is scanned once, then the shared string table is scanned
+     * once for all of them and only the referenced strings are resolved.
+     *
+     * @param queries The worksheets and columns to read.
+     * @return        One table per query, in the same order as `queries`.
+     * @throws std::runtime_error if a worksheet does not exist or the archive is corrupt.
+     */
+    std::vector<XlsxTable> read(const std::vector<XlsxSheetQuery>& queries);
+};
@@ -19,8 +19,109 @@
 #include "dbdynblk.h"
 #include "dbeval.h"
 #include "acdb.h"
+#include "actrans.h"
 #include "rxregsvc.h"
 
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct AcadOpenCounter
+ * @brief Number of database objects opened and closed through these helpers.
+ *
+ * Objects created by the helpers count as opened. Objects fetched inside a
+ * transaction are counted as closed when the outermost transaction ends.
+ */
+struct AcadOpenCounter {
+    long opens = 0;  ///< Objects opened (or created) for the caller.
+    long closes = 0; ///< Objects closed again.
+};
+
+/**
+ * @brief Get the open/close counts since the last reset.
+ *
+ * @return The counts.
+ */
+AcadOpenCounter acadGetOpenCounter();
+
+/**
+ * @brief Reset the open/close counts to zero.
+ */
+void acadResetOpenCounter();
+
+/**
+ * @brief Start a transaction on the working database.
+ *
+ * While a transaction is active, every helper fetches objects through it
+ * instead of opening and closing them, and objects stay open until the
+ * transaction ends.
+ *
+ * @return Acad::ErrorStatus indicating success or failure of the operation.
+ */
+Acad::ErrorStatus acadStartTransaction();
+
+/**
+ * @brief End the innermost transaction started with `acadStartTransaction`.
+ *
+ * @param commit true to keep the changes made in the transaction, false to undo them.
+ *
+ * @return Acad::ErrorStatus indicating success or failure of the operation.
+ */
+Acad::ErrorStatus acadEndTransaction(bool commit = true);
+
+/**
+ * @brief Open a database object.
+ *
+ * Fetches the object through the active transaction if there is one, and
+ * opens it directly otherwise. Objects opened here must be released with
+ * `acadCloseObject`.
+ *
+ * @param pObj  Receives the open object.
+ * @param objId The object ID of the object to open.
+ * @param mode  Open mode (AcDb::kForRead or AcDb::kForWrite).
+ *
+ * @return Acad::ErrorStatus indicating success or failure of the operation.
+ */
+Acad::ErrorStatus acadOpenObject(AcDbObject*& pObj, const AcDbObjectId& objId, AcDb::OpenMode mode);
+
+/**
+ * @brief Open a database object of a specific class.
+ *
+ * @return Acad::ErrorStatus indicating success or failure of the operation.
+ *         Returns Acad::eNotThatKindOfClass if the object is not a `T`.
+ */
+template <class T>
+Acad::ErrorStatus acadOpenObject(T*& pObj, const AcDbObjectId& objId, AcDb::OpenMode mode);
+
+/**
+ * @brief Release an object opened with `acadOpenObject`.
+ *
+ * Inside a transaction the object stays open until the transaction ends.
+ *
+ * @param pObj The object to release. Ignored if nullptr.
+ */
+void acadCloseObject(AcDbObject* pObj);
+
+template <class T>
+Acad::ErrorStatus acadOpenObject(T*& pObj, const AcDbObjectId& objId, AcDb::OpenMode mode) {
+    pObj = nullptr;
+
+    AcDbObject* pBase = nullptr;
+    Acad::ErrorStatus es = acadOpenObject(pBase, objId, mode);
+    if (es != Acad::eOk) return es;
+
+    pObj = T::cast(pBase);
+    if (!pObj) {
+        acadCloseObject(pBase);
+        return Acad::eNotThatKindOfClass;
+    }
+
+    return Acad::eOk;
+}
+
 /**
  * @brief Insert a block into the database at a specified origin point.
  *
@@ -36,6 +137,100 @@
  */
 AcDbObjectId acadInsertBlock(const wchar_t* blockName, const AcGePoint3d& origin);
 
+/**
+ * @brief Insert a block into an already open block table record.
+ *
+ * The new block reference is left open for writing. Release it with
+ * `acadCloseObject` when done.
+ *
+ * @param pBlockTable The open block table.
+ * @param pSpace      The block table record (usually model space) open for writing.
+ * @param blockName   The name of the block to be inserted.
+ * @param origin      The 3D point where the block should be placed.
+ * @param pBlockRef   Receives the new block reference, or nullptr if it could not
+ *                    be added.
+ *
+ * @return Acad::ErrorStatus indicating success or failure of the operation.
+ */
+Acad::ErrorStatus acadInsertBlock(
+    AcDbBlockTable* pBlockTable,
+    AcDbBlockTableRecord* pSpace,
+    const wchar_t* blockName,
+    const AcGePoint3d& origin,
+    AcDbBlockReference*& pBlockRef
+);
+
+/**
+ * @struct AcadTagLess
+ * @brief Orders attribute tags the way AutoCAD matches them, ignoring case.
+ */
+struct AcadTagLess {
+    bool operator()(const std::wstring& a, const std::wstring& b) const {
+        return _wcsicmp(a.c_str(), b.c_str()) < 0;
+    }
+};
+
+/// Attribute values by tag.
+typedef std::map<std::wstring, std::wstring, AcadTagLess> AcadAttributeMap;
+
+/// Dynamic block property values, applied in order.
+typedef std::vector<std::pair<std::wstring, AcDbEvalVariant>> AcadDynPropertyList;
+
+/// Position of each property in `AcDbDynBlockReference::getBlockProperties`, by property name.
+typedef std::map<std::wstring, int> AcadDynPropertyIndex;
+
+/// Property positions by dynamic block definition.
+typedef std::map<AcDbObjectId, AcadDynPropertyIndex> AcadDynPropertyCache;
+
+/**
+ * @struct AcadBlockDefinition
+ * @brief A block definition prepared for repeated insertion.
+ *
+ * The attributes are created once from the definition's non-constant
+ * attribute definitions, in block coordinates, and are cloned into every
+ * inserted reference.
+ */
+struct AcadBlockDefinition {
+    AcDbObjectId id;                                        ///< The block table record.
+    std::vector<std::unique_ptr<AcDbAttribute>> attributes; ///< Attribute templates, not database resident.
+};
+
+/**
+ * @brief Look up a block definition and extract its attribute templates.
+ *
+ * @param pBlockTable The open block table.
+ * @param blockName   The name of the block.
+ * @param outDef      Receives the definition.
+ *
+ * @return Acad::ErrorStatus indicating success or failure of the operation.
+ */
+Acad::ErrorStatus acadGetBlockDefinition(
+    AcDbBlockTable* pBlockTable,
+    const wchar_t* blockName,
+    AcadBlockDefinition& outDef
+);
+
+/**
+ * @brief Insert a prepared block definition into an already open block table record.
+ *
+ * The new block reference is left open for writing. Release it with
+ * `acadCloseObject` when done.
+ *
+ * @param pSpace    The block table record (usually model space) open for writing.
+ * @param blockDef  The block definition, from `acadGetBlockDefinition`.
+ * @param origin    The 3D point where the block should be placed.
+ * @param pBlockRef Receives the new block reference, or nullptr if it could not
+ *                  be added.
+ *
+ * @return Acad::ErrorStatus indicating success or failure of the operation.
+ */
+Acad::ErrorStatus acadInsertBlock(
+    AcDbBlockTableRecord* pSpace,
+    const AcadBlockDefinition& blockDef,
+    const AcGePoint3d& origin,
+    AcDbBlockReference*& pBlockRef
+);
+
 /**
  * @brief Set a dynamic block property to a new value.
  *
@@ -56,6 +251,15 @@ Acad::ErrorStatus acadSetDynBlockProperty(
     const AcDbEvalVariant& newValue
 );
 
+/**
+ * @brief Set a dynamic block property of a block reference that is already open for writing.
+ */
+Acad::ErrorStatus acadSetDynBlockProperty(
+    AcDbBlockReference* pBlkRef,
+    const wchar_t* propName,
+    const AcDbEvalVariant& newValue
+);
+
 /**
  * @brief Retrieve the value of a dynamic block property.
  *
@@ -77,6 +281,46 @@ Acad::ErrorStatus acadGetDynBlockProperty(
     AcDbEvalVariant& outValue
 );
 
+/**
+ * @brief Retrieve a dynamic block property of a block reference that is already open.
+ */
+Acad::ErrorStatus acadGetDynBlockProperty(
+    AcDbBlockReference* pBlkRef,
+    const wchar_t* propName,
+    AcDbEvalVariant& outValue
+);
+
+/**
+ * @brief Set several dynamic block properties with one property enumeration.
+ *
+ * The properties of the block reference are enumerated once and every value
+ * is applied from that enumeration, in order. If a cache is given, the
+ * position of each property is remembered per dynamic block definition, so
+ * later references of the same block find their properties without searching
+ * by name.
+ *
+ * @param blockRefId The object ID of the dynamic block reference.
+ * @param values     Property names and their new values.
+ * @param pCache     Optional property positions shared between calls.
+ *
+ * @return Acad::ErrorStatus indicating success or failure of the operation.
+ *         Returns the first failure; the remaining values are still applied.
+ */
+Acad::ErrorStatus acadSetDynBlockProperties(
+    const AcDbObjectId& blockRefId,
+    const AcadDynPropertyList& values,
+    AcadDynPropertyCache* pCache = nullptr
+);
+
+/**
+ * @brief Set several dynamic block properties of a block reference that is already open for writing.
+ */
+Acad::ErrorStatus acadSetDynBlockProperties(
+    AcDbBlockReference* pBlkRef,
+    const AcadDynPropertyList& values,
+    AcadDynPropertyCache* pCache = nullptr
+);
+
 /**
  * @brief Set a block attribute to a new value.
  *
@@ -96,6 +340,15 @@ Acad::ErrorStatus acadSetBlockAttribute(
     const wchar_t* newValue
 );
 
+/**
+ * @brief Set a block attribute of a block reference that is already open.
+ */
+Acad::ErrorStatus acadSetBlockAttribute(
+    AcDbBlockReference* pBlkRef,
+    const wchar_t* tagName,
+    const wchar_t* newValue
+);
+
 /**
  * @brief Retrieve the text value of a block attribute.
  *
@@ -118,6 +371,65 @@ Acad::ErrorStatus acadGetBlockAttribute(
     std::wstring&       outValue
 );
 
+/**
+ * @brief Retrieve a block attribute of a block reference that is already open.
+ */
+Acad::ErrorStatus acadGetBlockAttribute(
+    AcDbBlockReference* pBlkRef,
+    const wchar_t*      tagName,
+    std::wstring&       outValue
+);
+
+/**
+ * @brief Set several block attributes in a single pass.
+ *
+ * Each attribute of the block reference is visited once. Attributes whose tag
+ * is in `values` are opened for writing, updated and realigned; the others are
+ * only read.
+ *
+ * @param blockRefId The object ID of the block reference.
+ * @param values     New values by tag. Tags are matched ignoring case.
+ *
+ * @return Acad::ErrorStatus indicating success or failure of the operation.
+ *         - Acad::eOk           – every tag was found and updated.
+ *         - Acad::eKeyNotFound  – at least one tag is not present. The tags
+ *                                 that are present are still updated.
+ *         - Other Acad errors   – object open failure, iterator error, etc.
+ */
+Acad::ErrorStatus acadSetBlockAttributes(
+    const AcDbObjectId&     blockRefId,
+    const AcadAttributeMap& values
+);
+
+/**
+ * @brief Set several block attributes of a block reference that is already open.
+ */
+Acad::ErrorStatus acadSetBlockAttributes(
+    AcDbBlockReference*     pBlkRef,
+    const AcadAttributeMap& values
+);
+
+/**
+ * @brief Retrieve every block attribute in a single pass.
+ *
+ * @param blockRefId The object ID of the block reference.
+ * @param outValues  Receives the value of every attribute by tag.
+ *
+ * @return Acad::ErrorStatus indicating success or failure of the operation.
+ */
+Acad::ErrorStatus acadGetBlockAttributes(
+    const AcDbObjectId& blockRefId,
+    AcadAttributeMap&   outValues
+);
+
+/**
+ * @brief Retrieve every block attribute of a block reference that is already open.
+ */
+Acad::ErrorStatus acadGetBlockAttributes(
+    AcDbBlockReference* pBlkRef,
+    AcadAttributeMap&   outValues
+);
+
 /**
  * @brief Set a general object property to a new value.
  *
@@ -137,6 +449,15 @@ Acad::ErrorStatus acadSetObjectProperty(
     const wchar_t* value
 );
 
+/**
+ * @brief Set a general property of an entity that is already open for writing.
+ */
+Acad::ErrorStatus acadSetObjectProperty(
+    AcDbEntity* pEnt,
+    AcDb::DxfCode groupCode,
+    const wchar_t* value
+);
+
 /**
  * @brief Set the position of a supported entity.
  *
@@ -155,6 +476,14 @@ Acad::ErrorStatus acadSetObjectPosition(
     const AcGePoint3d& position
 );
 
+/**
+ * @brief Set the position of an entity that is already open for writing.
+ */
+Acad::ErrorStatus acadSetObjectPosition(
+    AcDbEntity* pEnt,
+    const AcGePoint3d& position
+);
+
 /**
  * @brief Get the position of a supported entity.
  *
@@ -172,6 +501,14 @@ Acad::ErrorStatus acadGetObjectPosition(
     AcGePoint3d& outPosition
 );
 
+/**
+ * @brief Get the position of an entity that is already open.
+ */
+Acad::ErrorStatus acadGetObjectPosition(
+    AcDbEntity* pEnt,
+    AcGePoint3d& outPosition
+);
+
 /**
  * @brief Set the scale of a supported entity.
  *
@@ -188,6 +525,14 @@ Acad::ErrorStatus acadSetObjectScale(
     const AcGeScale3d& scale
 );
 
+/**
+ * @brief Set the scale of an entity that is already open for writing.
+ */
+Acad::ErrorStatus acadSetObjectScale(
+    AcDbEntity* pEnt,
+    const AcGeScale3d& scale
+);
+
 /**
  * @brief Get the scale of a supported entity.
  *
@@ -204,6 +549,14 @@ Acad::ErrorStatus acadGetObjectScale(
     AcGeScale3d& outScale
 );
 
+/**
+ * @brief Get the scale of an entity that is already open.
+ */
+Acad::ErrorStatus acadGetObjectScale(
+    AcDbEntity* pEnt,
+    AcGeScale3d& outScale
+);
+
 /**
  * @brief Get block name that an object references
  * 
@@ -219,4 +572,56 @@ Acad::ErrorStatus acadGetObjectScale(
 Acad::ErrorStatus acadGetBlockName(
     const AcDbObjectId& objId,
     std::wstring &name
-);
\ No newline at end of file
+);
+
+/**
+ * @brief Get the block name of a block reference that is already open.
+ *
+ * For dynamic blocks this is the name of the dynamic block definition, not
+ * of the anonymous block the reference points to.
+ */
+Acad::ErrorStatus acadGetBlockName(
+    AcDbBlockReference* pBlockRef,
+    std::wstring &name
+);
+
+/**
+ * @brief Open a dictionary of the named objects dictionary.
+ *
+ * @param pDb    The database.
+ * @param name   Key of the dictionary in the named objects dictionary.
+ * @param pDict  Receives the dictionary.
+ * @param mode   Mode to open the dictionary in.
+ * @param create true to add the dictionary if it does not exist yet.
+ *
+ * @return Acad::ErrorStatus indicating success or failure of the operation.
+ *         Returns eKeyNotFound if the dictionary does not exist and `create`
+ *         is false.
+ */
+Acad::ErrorStatus acadOpenNamedDictionary(
+    AcDbDatabase* pDb,
+    const ACHAR* name,
+    AcDbDictionary*& pDict,
+    AcDb::OpenMode mode,
+    bool create = false
+);
+
+/**
+ * @brief Add a new object to a dictionary that is open for writing.
+ *
+ * The object is released once it is added: handed to the transaction if one
+ * is active, closed otherwise. On failure it is deleted.
+ *
+ * @param pDict The dictionary, open for writing.
+ * @param key   Key of the new entry.
+ * @param pObj  The new object.
+ * @param objId Receives the id of the new object.
+ *
+ * @return Acad::ErrorStatus indicating success or failure of the operation.
+ */
+Acad::ErrorStatus acadAddDictionaryObject(
+    AcDbDictionary* pDict,
+    const ACHAR* key,
+    AcDbObject* pObj,
+    AcDbObjectId& objId
+);
@@ -0,0 +1,211 @@
+/**
+ * @file ArxDrawBackend.cpp
+ * @brief Definitions for the ArxDrawBackend class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "ArxDrawBackend.h"
+
+#include <utility>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Internal Types
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Everything recorded for one block.
+ */
+struct _BlockState {
+    const std::wstring* pName = nullptr;   ///< Block name.
+    AcGePoint3d origin;                    ///< Insertion point.
+    AcadDynPropertyList properties;        ///< Dynamic block properties, in recorded order.
+    AcadAttributeMap attributes;           ///< Attribute values by tag.
+    const std::wstring* pLayer = nullptr;  ///< Layer, or nullptr to keep the block's own.
+    bool scaled = false;                   ///< true if `scale` was recorded.
+    AcGeScale3d scale;                     ///< Scale factors.
+};
+
+/**
+ * @brief A run of consecutive blocks drawn together.
+ */
+struct _BlockGroup {
+    const std::wstring* pShape = nullptr; ///< Shape of a recorded group, or nullptr for a lone block.
+    AcGePoint3d origin;                   ///< Origin of the group.
+    std::uint32_t first = 0;              ///< First block of the group.
+    std::uint32_t count = 0;              ///< Number of blocks in the group.
+};
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Convert a recorded property value to an AutoCAD value.
+ */
+static AcDbEvalVariant _propertyValue(const DrawBuffer& buffer, const DrawCommand& command);
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+ArxDrawBackend::ArxDrawBackend(BlockCache& cache, CablePrototypeCache& prototypes) :
+_cache(cache),
+_prototypes(prototypes)
+{}
+
+void ArxDrawBackend::execute(const DrawBuffer& buffer) {
+    _groupEntities.clear();
+
+    // Sort the commands by block, in one pass
+    std::vector<_BlockState> blocks(buffer.getBlockCount());
+    std::vector<_BlockGroup> groups;
+    bool inGroup = false;
+
+    for (const DrawCommand& command : buffer.getCommands()) {
+        switch (command.op)
+        {
+        case DrawOp::INSERT_BLOCK :
+            blocks[command.block].pName = &buffer.getString(command.name);
+            blocks[command.block].origin.set(command.x, command.y, 0.0);
+
+            if (!inGroup) groups.push_back({ nullptr, blocks[command.block].origin, command.block, 0 });
+            groups.back().count++;
+            break;
+
+        case DrawOp::SET_ATTRIBUTE :
+            blocks[command.block].attributes[buffer.getString(command.name)] = buffer.getString(command.text);
+            break;
+
+        case DrawOp::SET_PROPERTY :
+            blocks[command.block].properties.emplace_back(buffer.getString(command.name), _propertyValue(buffer, command));
+            break;
+
+        case DrawOp::SET_LAYER :
+            blocks[command.block].pLayer = &buffer.getString(command.name);
+            break;
+
+        case DrawOp::SET_SCALE :
+            blocks[command.block].scaled = true;
+            blocks[command.block].scale = AcGeScale3d(command.x, command.y, command.z);
+            break;
+
+        case DrawOp::BEGIN_GROUP :
+            groups.push_back({ &buffer.getString(command.name), AcGePoint3d(command.x, command.y, 0.0), command.block, 0 });
+            inGroup = true;
+            break;
+
+        case DrawOp::END_GROUP :
+            inGroup = false;
+            break;
+        }
+    }
+
+    // Every block of the buffer is inserted and edited inside one transaction
+    DrawingSession session(_cache, _prototypes);
+    if (!session.isOpen()) return;
+
+    std::vector<AcDbBlockReference*> entities;
+    for (const _BlockGroup& group : groups) {
+        const CablePrototype* pPrototype = group.pShape ? session.findPrototype(*group.pShape) : nullptr;
+
+        // Copy the group from the first one of its shape, writing only the attributes that differ
+        if (pPrototype && pPrototype->entities.size() == group.count &&
+            session.clonePrototype(*pPrototype, group.origin, entities) == Acad::eOk) {
+            for (std::uint32_t i = 0; i < group.count; ++i) {
+                AcadAttributeMap changed;
+                for (const auto& attribute : blocks[group.first + i].attributes) {
+                    auto it = pPrototype->attributes[i].find(attribute.first);
+                    if (it == pPrototype->attributes[i].end() || it->second != attribute.second) {
+                        changed.insert(attribute);
+                    }
+                }
+
+                if (!changed.empty()) acadSetBlockAttributes(entities[i], changed);
+            }
+
+            _addGroupEntities(entities);
+            continue;
+        }
+
+        // Draw the group block by block, applying everything recorded for a block at once
+        entities.clear();
+        for (std::uint32_t i = 0; i < group.count; ++i) {
+            const _BlockState& block = blocks[group.first + i];
+
+            AcDbBlockReference* pBlockRef = session.insertBlock(block.pName->c_str(), block.origin);
+            entities.push_back(pBlockRef);
+            if (!pBlockRef) continue;
+
+            if (!block.properties.empty()) session.setDynBlockProperties(pBlockRef, block.properties);
+            if (block.pLayer) session.setLayer(pBlockRef, block.pLayer->c_str());
+            if (block.scaled) acadSetObjectScale(pBlockRef, block.scale);
+            if (!block.attributes.empty()) acadSetBlockAttributes(pBlockRef, block.attributes);
+        }
+
+        if (!group.pShape) continue;
+
+        _addGroupEntities(entities);
+
+        // Keep the group as the prototype of its shape if every block was drawn
+        CablePrototype prototype;
+        prototype.origin = group.origin;
+
+        bool complete = true;
+        for (std::uint32_t i = 0; i < group.count; ++i) {
+            if (!entities[i]) {
+                complete = false;
+                break;
+            }
+
+            prototype.entities.push_back(entities[i]->objectId());
+            prototype.attributes.push_back(blocks[group.first + i].attributes);
+        }
+
+        if (complete) session.addPrototype(*group.pShape, std::move(prototype));
+    }
+}
+
+const std::vector<std::vector<AcDbObjectId>>& ArxDrawBackend::getGroupEntities() const {
+    return _groupEntities;
+}
+
+void ArxDrawBackend::_addGroupEntities(const std::vector<AcDbBlockReference*>& entities) {
+    std::vector<AcDbObjectId> ids;
+    ids.reserve(entities.size());
+
+    for (AcDbBlockReference* pBlockRef : entities) {
+        ids.push_back(pBlockRef ? pBlockRef->objectId() : AcDbObjectId::kNull);
+    }
+
+    _groupEntities.push_back(std::move(ids));
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static AcDbEvalVariant _propertyValue(const DrawBuffer& buffer, const DrawCommand& command) {
+    switch (command.valueType)
+    {
+    case DrawValueType::SHORT :
+        return AcDbEvalVariant(static_cast<short>(command.x));
+
+    case DrawValueType::DOUBLE :
+        return AcDbEvalVariant(command.x);
+
+    case DrawValueType::STRING :
+        return AcDbEvalVariant(buffer.getString(command.text).c_str());
+
+    default:
+        return AcDbEvalVariant();
+    }
+}
@@ -0,0 +1,82 @@
+/**
+ * @file BlockCache.cpp
+ * @brief Definitions for the BlockCache class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "BlockCache.h"
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+const AcadBlockDefinition* BlockCache::getBlock(AcDbDatabase* pDb, const wchar_t* blockName) {
+    _checkDatabase(pDb);
+
+    auto it = _blocks.find(blockName);
+    if (it != _blocks.end()) return &it->second;
+
+    AcDbBlockTable* pBlockTable = nullptr;
+    if (acadOpenObject(pBlockTable, pDb->blockTableId(), AcDb::kForRead) != Acad::eOk) {
+        acutPrintf(L"\nError: Could not access block table.");
+        return nullptr;
+    }
+
+    AcadBlockDefinition blockDef;
+    Acad::ErrorStatus es = acadGetBlockDefinition(pBlockTable, blockName, blockDef);
+    acadCloseObject(pBlockTable);
+
+    if (es != Acad::eOk) return nullptr;
+
+    return &_blocks.emplace(blockName, std::move(blockDef)).first->second;
+}
+
+AcDbObjectId BlockCache::getLayer(AcDbDatabase* pDb, const wchar_t* layerName) {
+    _checkDatabase(pDb);
+
+    auto it = _layers.find(layerName);
+    if (it != _layers.end()) return it->second;
+
+    AcDbLayerTable* pLayerTable = nullptr;
+    if (acadOpenObject(pLayerTable, pDb->layerTableId(), AcDb::kForRead) != Acad::eOk) {
+        acutPrintf(L"\nError: Could not access layer table.");
+        return AcDbObjectId::kNull;
+    }
+
+    AcDbObjectId layerId;
+    if (pLayerTable->getAt(layerName, layerId) != Acad::eOk) {
+        acutPrintf(L"\nError: Layer '%ls' not found in drawing.", layerName);
+        layerId = AcDbObjectId::kNull;
+    }
+    acadCloseObject(pLayerTable);
+
+    // Missing layers are remembered too, so the error is only reported once
+    _layers[layerName] = layerId;
+    return layerId;
+}
+
+AcadDynPropertyCache& BlockCache::getDynProperties() {
+    return _properties;
+}
+
+void BlockCache::clear() {
+    _pDb = nullptr;
+    _blocks.clear();
+    _layers.clear();
+    _properties.clear();
+}
+
+void BlockCache::_checkDatabase(AcDbDatabase* pDb) {
+    if (pDb == _pDb) return;
+
+    clear();
+    _pDb = pDb;
+}
@@ -0,0 +1,44 @@
+/**
+ * @file BlockKindCache.cpp
+ * @brief Definitions for the BlockKindCache class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "BlockKindCache.h"
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+Acad::ErrorStatus BlockKindCache::getKind(AcDbBlockReference* pBlockRef, BlockKind& kind) {
+    if (!pBlockRef) return Acad::eNullObjectPointer;
+
+    AcDbObjectId blockDefId = pBlockRef->blockTableRecord();
+
+    auto it = _kinds.find(blockDefId);
+    if (it != _kinds.end()) {
+        kind = it->second;
+        return Acad::eOk;
+    }
+
+    std::wstring blockName;
+    Acad::ErrorStatus es = acadGetBlockName(pBlockRef, blockName);
+    if (es != Acad::eOk) return es;
+
+    kind = getBlockKind(blockName);
+    _kinds[blockDefId] = kind;
+
+    return Acad::eOk;
+}
+
+void BlockKindCache::clear() {
+    _kinds.clear();
+}
@@ -0,0 +1,157 @@
+/**
+ * @file BoxCatalog.cpp
+ * @brief Definitions for the Enclosure and BoxCatalog classes.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "BoxCatalog.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Remove leading and trailing whitespace.
+ */
+static std::string _trim(const std::string& text);
+
+/**
+ * @brief Parse a whole field as a number.
+ *
+ * @throws std::runtime_error if the field is empty, is not finite or has
+ *         anything after the number.
+ */
+static double _parseNumber(const std::string& field);
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+int Enclosure::getCapacity() const {
+    int capacity = 0;
+    for (const TableSpec& table : tables) capacity += table.capacity;
+    return capacity;
+}
+
+BoxCatalog BoxCatalog::open(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file) {
+        throw std::runtime_error("Failed to open enclosure catalog: " + filename);
+    }
+
+    return parse(file);
+}
+
+BoxCatalog BoxCatalog::parse(std::istream& in) {
+    BoxCatalog catalog;
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line)) {
+        lineNumber++;
+
+        line = _trim(line);
+        if (line.empty() || line[0] == '#') continue;
+
+        std::vector<std::string> fields;
+        std::stringstream stream(line);
+        std::string field;
+        while (std::getline(stream, field, ',')) fields.push_back(_trim(field));
+        if (!line.empty() && line.back() == ',') fields.push_back("");
+
+        try {
+            if (fields.size() != 5) {
+                throw std::runtime_error("expected 5 fields, found " + std::to_string(fields.size()));
+            }
+
+            if (fields[0].empty()) throw std::runtime_error("missing enclosure name");
+
+            double capacity = _parseNumber(fields[1]);
+            if (capacity < 1 || capacity > std::numeric_limits<int>::max() || capacity != std::floor(capacity)) {
+                throw std::runtime_error("capacity must be a positive whole number");
+            }
+
+            double flip = _parseNumber(fields[4]);
+            if (flip != 0 && flip != 1) throw std::runtime_error("flip must be 0 or 1");
+
+            TableSpec table;
+            table.capacity = static_cast<int>(capacity);
+            table.originX = _parseNumber(fields[2]);
+            table.originY = _parseNumber(fields[3]);
+            table.flip = flip != 0;
+
+            Enclosure* enclosure = nullptr;
+            for (Enclosure& existing : catalog._enclosures) {
+                if (existing.name == fields[0]) enclosure = &existing;
+            }
+
+            if (!enclosure) {
+                catalog._enclosures.push_back({ fields[0], {} });
+                enclosure = &catalog._enclosures.back();
+            }
+
+            for (const TableSpec& existing : enclosure->tables) {
+                if (existing.originX == table.originX && existing.originY == table.originY) {
+                    throw std::runtime_error(fields[0] + " already has a table at this origin");
+                }
+            }
+
+            enclosure->tables.push_back(table);
+        } catch (const std::exception& e) {
+            throw std::runtime_error("Enclosure catalog is not compatible: line " + std::to_string(lineNumber) + ": " + e.what());
+        }
+    }
+
+    return catalog;
+}
+
+const std::vector<Enclosure>& BoxCatalog::getEnclosures() const {
+    return _enclosures;
+}
+
+const Enclosure* BoxCatalog::find(const std::string& name) const {
+    for (const Enclosure& enclosure : _enclosures) {
+        if (enclosure.name == name) return &enclosure;
+    }
+
+    return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static std::string _trim(const std::string& text) {
+    size_t first = text.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos) return "";
+
+    size_t last = text.find_last_not_of(" \t\r\n");
+    return text.substr(first, last - first + 1);
+}
+
+static double _parseNumber(const std::string& field) {
+    const char* begin = field.c_str();
+    char* end = nullptr;
+    double value = std::strtod(begin, &end);
+
+    if (field.empty() || *end != '\0' || !std::isfinite(value)) {
+        throw std::runtime_error("\"" + field + "\" is not a number");
+    }
+
+    return value;
+}
@@ -0,0 +1,256 @@
+/**
+ * @file CableFlip.cpp
+ * @brief Definitions for flipping drawn cables.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "CableFlip.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "BlockKindCache.h"
+
+// -----------------------------------------------------------------------------
+// Internal Constants
+// -----------------------------------------------------------------------------
+
+static const double _tolerance = 1e-6;          ///< Slack for comparing drawing coordinates.
+static const double _terminalRise = 0.125;      ///< Height of a device's first terminal above its cable's termination.
+static const double _cableReach = 10.5;         ///< Furthest horizontal distance of a cable's blocks from its termination.
+
+// Horizontal distance from the termination's axis, used to flip a block whose
+// termination is not selected
+static const double _fieldDeviceOffset = 9.0;   ///< Field Device Termination.
+static const double _terminalOffset = 9.3438;   ///< TBWIREMINI.
+static const double _symbolOffset = 9.93755;    ///< INST SYMBOL.
+
+// -----------------------------------------------------------------------------
+// Internal Types
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Which block of a cable an entity is.
+ */
+enum class _FlipKind {
+    TERMINATION,    ///< Junction Termination, the axis of the cable.
+    FIELD_DEVICE,   ///< Field Device Termination.
+    TERMINAL,       ///< TBWIREMINI, flipped with its X scale.
+    SYMBOL          ///< INST SYMBOL.
+};
+
+/**
+ * @brief A selected block of a cable.
+ */
+struct _FlipItem {
+    AcDbBlockReference* pBlockRef;  ///< The block, open for read in the transaction.
+    _FlipKind kind;                 ///< Which block of the cable it is.
+    AcGePoint3d position;           ///< Insertion point.
+    bool flipped;                   ///< true if the block is drawn to the right.
+};
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Get which block of a cable a block is.
+ *
+ * @return true if the block is part of a cable, false otherwise.
+ */
+static bool _flipKind(BlockKind blockKind, _FlipKind& kind);
+
+/**
+ * @brief Get the name of the dynamic property holding a block's flip state.
+ */
+static const ACHAR* _flipProperty(_FlipKind kind);
+
+/**
+ * @brief Find the termination a block belongs to.
+ *
+ * @param item         The block.
+ * @param items        Every selected block.
+ * @param terminations Indices of the terminations in `items`, sorted by Y.
+ * @return             Index of the termination in `items`, or -1 if it is not selected.
+ */
+static int _findTermination(const _FlipItem& item, const std::vector<_FlipItem>& items, const std::vector<size_t>& terminations);
+
+/**
+ * @brief Get the axis a block whose termination is not selected is flipped about.
+ */
+static double _impliedAxis(const _FlipItem& item);
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+Acad::ErrorStatus flipCables(const std::vector<AcDbObjectId>& objIds, int& cableCount) {
+    cableCount = 0;
+
+    Acad::ErrorStatus es = acadStartTransaction();
+    if (es != Acad::eOk) return es;
+
+    // Open every block once and read everything the flip needs. Blocks sharing
+    // a definition are only classified once.
+    BlockKindCache kindCache;
+    std::vector<_FlipItem> items;
+    items.reserve(objIds.size());
+
+    for (const AcDbObjectId& objId : objIds) {
+        AcDbBlockReference* pBlockRef = nullptr;
+        if (acadOpenObject(pBlockRef, objId, AcDb::kForRead) != Acad::eOk) continue; // not a block
+
+        BlockKind blockKind;
+        es = kindCache.getKind(pBlockRef, blockKind);
+        if (es != Acad::eOk) {
+            acutPrintf(L"\nError: Unable to get object block name.");
+            acadEndTransaction(false);
+            return es;
+        }
+
+        _FlipItem item;
+        if (!_flipKind(blockKind, item.kind)) continue;
+
+        item.pBlockRef = pBlockRef;
+        item.position = pBlockRef->position();
+
+        if (item.kind == _FlipKind::TERMINAL) {
+            item.flipped = pBlockRef->scaleFactors()[0] < 0.0;
+        } else {
+            AcDbEvalVariant flipVariant;
+            es = acadGetDynBlockProperty(pBlockRef, _flipProperty(item.kind), flipVariant);
+            if (es != Acad::eOk) {
+                acutPrintf(L"\nError: Unable to read the flip state of a block.");
+                acadEndTransaction(false);
+                return es;
+            }
+
+            int flipValue = 0;
+            flipVariant.getValue(flipValue);
+            item.flipped = flipValue != 0;
+        }
+
+        items.push_back(item);
+    }
+
+    // Terminations sorted by height, so each block finds its cable with a binary search
+    std::vector<size_t> terminations;
+    for (size_t i = 0; i < items.size(); ++i) {
+        if (items[i].kind == _FlipKind::TERMINATION) terminations.push_back(i);
+    }
+
+    std::sort(terminations.begin(), terminations.end(), [&](size_t a, size_t b) {
+        return items[a].position.y < items[b].position.y;
+    });
+
+    // One mirror transform per cable, about its termination's axis
+    std::vector<AcGeMatrix3d> mirrors(items.size());
+    for (size_t t : terminations) {
+        mirrors[t] = AcGeMatrix3d::mirroring(AcGePlane(AcGePoint3d(items[t].position.x, 0.0, 0.0), AcGeVector3d::kXAxis));
+    }
+
+    for (_FlipItem& item : items) {
+        es = item.pBlockRef->upgradeOpen();
+        if (es != Acad::eOk) break;
+
+        if (item.kind != _FlipKind::TERMINATION) {
+            int termination = _findTermination(item, items, terminations);
+
+            AcGeMatrix3d mirror;
+            if (termination >= 0) {
+                mirror = mirrors[termination];
+            } else {
+                mirror = AcGeMatrix3d::mirroring(AcGePlane(AcGePoint3d(_impliedAxis(item), 0.0, 0.0), AcGeVector3d::kXAxis));
+            }
+
+            acadSetObjectPosition(item.pBlockRef, mirror * item.position);
+        } else {
+            cableCount++;
+        }
+
+        if (item.kind == _FlipKind::TERMINAL) {
+            AcGeScale3d scale = item.pBlockRef->scaleFactors();
+            es = acadSetObjectScale(item.pBlockRef, AcGeScale3d(-scale[0], scale[1], scale[2]));
+        } else {
+            es = acadSetDynBlockProperty(item.pBlockRef, _flipProperty(item.kind), AcDbEvalVariant((short)(item.flipped ? 0 : 1)));
+        }
+
+        if (es != Acad::eOk) break;
+    }
+
+    // Keep the drawing consistent: either every block flips or none does
+    acadEndTransaction(es == Acad::eOk);
+
+    return es;
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static bool _flipKind(BlockKind blockKind, _FlipKind& kind) {
+    switch (blockKind)
+    {
+    case BlockKind::JUNCTION_TERM :
+    case BlockKind::JUNCTION_TERM7 :
+        kind = _FlipKind::TERMINATION;
+        return true;
+
+    case BlockKind::FIELD_DEV_TERM :
+    case BlockKind::FIELD_DEV_TERM7 :
+        kind = _FlipKind::FIELD_DEVICE;
+        return true;
+
+    case BlockKind::TB_WIRE_MINI :
+        kind = _FlipKind::TERMINAL;
+        return true;
+
+    case BlockKind::INST_SYMBOL :
+        kind = _FlipKind::SYMBOL;
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+static const ACHAR* _flipProperty(_FlipKind kind) {
+    return kind == _FlipKind::SYMBOL ? L"Flip state" : L"Flip state1";
+}
+
+static int _findTermination(const _FlipItem& item, const std::vector<_FlipItem>& items, const std::vector<size_t>& terminations) {
+    // The first termination that is not below the block's cable
+    double lowest = item.position.y - _terminalRise - _tolerance;
+    auto it = std::lower_bound(terminations.begin(), terminations.end(), lowest, [&](size_t t, double y) {
+        return items[t].position.y < y;
+    });
+
+    // Terminations of other tables may sit at the same height, so take the
+    // closest one whose cable is drawn towards the block
+    for (; it != terminations.end(); ++it) {
+        const _FlipItem& termination = items[*it];
+        double offset = item.position.x - termination.position.x;
+
+        bool towards = termination.flipped ? (offset >= -_tolerance) : (offset <= _tolerance);
+        if (towards && std::fabs(offset) <= _cableReach) return static_cast<int>(*it);
+    }
+
+    return -1;
+}
+
+static double _impliedAxis(const _FlipItem& item) {
+    double offset = _fieldDeviceOffset;
+    if (item.kind == _FlipKind::TERMINAL) offset = _terminalOffset;
+    if (item.kind == _FlipKind::SYMBOL) offset = _symbolOffset;
+
+    // A block drawn to the right sits to the right of its termination
+    return item.flipped ? item.position.x - offset : item.position.x + offset;
+}
@@ -0,0 +1,254 @@
+/**
+ * @file CableMoveWatcher.cpp
+ * @brief Definitions for renumbering cables automatically when they are moved.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "CableMoveWatcher.h"
+
+#include <algorithm>
+#include <cwchar>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "aced.h"
+#include "dbmain.h"
+
+#include "CableRecordStore.h"
+#include "CableReindex.h"
+
+// -----------------------------------------------------------------------------
+// Internal Constants
+// -----------------------------------------------------------------------------
+
+static const ACHAR* const _commandPrefix = L"GSTCH_"; ///< Prefix of the global names of the plugin's commands.
+
+/// Other commands whose changes are not renumbered.
+static const ACHAR* const _ignoredCommands[] = {
+    L"BUILDJUNCTION", L"FLIPCABLE", L"REINDEXCABLE", L"REINDEXALL", L"AUTOREINDEX",
+    L"EXPORTTERMINALS", L"VERIFYDRAWING", L"OPENCOUNTS",
+    L"UNDO", L"U", L"REDO", L"MREDO"
+};
+
+// -----------------------------------------------------------------------------
+// Internal Types
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief A block reference opened for modification, and its position before.
+ */
+struct _Move {
+    AcDbObjectId id;    ///< The block reference.
+    double x;           ///< X coordinate before the command changed it.
+    double y;           ///< Y coordinate before the command changed it.
+};
+
+/**
+ * @brief Notes the blocks a command modifies.
+ */
+class _DatabaseWatcher : public AcDbDatabaseReactor
+{
+public:
+    void objectOpenedForModify(const AcDbDatabase* pDb, const AcDbObject* pObj) override;
+    void goodbye(const AcDbDatabase* pDb) override;
+};
+
+/**
+ * @brief Renumbers the moved blocks when a command ends.
+ */
+class _CommandWatcher : public AcEditorReactor
+{
+public:
+    void commandWillStart(const ACHAR* cmdStr) override;
+    void commandEnded(const ACHAR* cmdStr) override;
+    void commandCancelled(const ACHAR* cmdStr) override;
+    void commandFailed(const ACHAR* cmdStr) override;
+};
+
+// -----------------------------------------------------------------------------
+// Internal State
+// -----------------------------------------------------------------------------
+
+static AcDbDatabase* _pDb = nullptr;                                 ///< The watched database.
+static std::unique_ptr<_DatabaseWatcher> _pDatabaseWatcher;          ///< Reactor on `_pDb`.
+static std::unique_ptr<_CommandWatcher> _pCommandWatcher;            ///< Reactor on the editor.
+static std::vector<bool> _commands;                                  ///< Whether each running command is watched, outermost first.
+static bool _watching = false;                                       ///< true while every running command is watched.
+static std::vector<_Move> _moves;                                    ///< Blocks modified by the current command.
+static std::unordered_set<AcDbObjectId, AcadObjectIdHash> _noted;    ///< Ids in `_moves`.
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Check if a command's changes are renumbered.
+ */
+static bool _isWatched(const ACHAR* cmdStr);
+
+/**
+ * @brief Renumber the terminations the command moved to another slot.
+ */
+static void _applyMoves();
+
+/**
+ * @brief Forget the blocks of the current command.
+ */
+static void _clearMoves();
+
+/**
+ * @brief Note that the innermost running command finished.
+ *
+ * @param apply true to renumber the moved blocks if it was the outermost
+ *              command and it is watched.
+ */
+static void _endCommand(bool apply);
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+Acad::ErrorStatus startCableMoveWatcher(AcDbDatabase* pDb) {
+    if (!pDb) return Acad::eNullObjectPointer;
+    if (pDb == _pDb) return Acad::eOk;
+
+    stopCableMoveWatcher();
+
+    _pDb = pDb;
+    _pDatabaseWatcher.reset(new _DatabaseWatcher());
+    _pCommandWatcher.reset(new _CommandWatcher());
+
+    _pDb->addReactor(_pDatabaseWatcher.get());
+    acedEditor->addReactor(_pCommandWatcher.get());
+
+    return Acad::eOk;
+}
+
+void stopCableMoveWatcher() {
+    if (_pDb && _pDatabaseWatcher) _pDb->removeReactor(_pDatabaseWatcher.get());
+    if (_pCommandWatcher) acedEditor->removeReactor(_pCommandWatcher.get());
+
+    _pDb = nullptr;
+    _pDatabaseWatcher.reset();
+    _pCommandWatcher.reset();
+    _commands.clear();
+    _watching = false;
+    _clearMoves();
+}
+
+bool isCableMoveWatcherRunning(AcDbDatabase* pDb) {
+    return pDb && pDb == _pDb;
+}
+
+void _DatabaseWatcher::objectOpenedForModify(const AcDbDatabase* pDb, const AcDbObject* pObj) {
+    if (!_watching || pDb != _pDb) return;
+
+    // Only note the position here; the name is resolved once, at the end of the command
+    const AcDbBlockReference* pBlockRef = AcDbBlockReference::cast(pObj);
+    if (!pBlockRef) return;
+
+    if (_noted.insert(pBlockRef->objectId()).second) {
+        AcGePoint3d position = pBlockRef->position();
+        _moves.push_back({ pBlockRef->objectId(), position.x, position.y });
+    }
+}
+
+void _DatabaseWatcher::goodbye(const AcDbDatabase* pDb) {
+    if (pDb != _pDb) return;
+
+    // The database is being destroyed, so its reactor must not be removed
+    _pDb = nullptr;
+    stopCableMoveWatcher();
+}
+
+void _CommandWatcher::commandWillStart(const ACHAR* cmdStr) {
+    // A transparent or nested command ('ZOOM, 'PAN) is part of the command it
+    // runs in, so only the outermost command starts a new set of moves
+    if (_commands.empty()) _clearMoves();
+
+    _commands.push_back(_isWatched(cmdStr));
+    _watching = std::find(_commands.begin(), _commands.end(), false) == _commands.end();
+}
+
+void _CommandWatcher::commandEnded(const ACHAR*) {
+    _endCommand(true);
+}
+
+void _CommandWatcher::commandCancelled(const ACHAR*) {
+    // A cancelled command can still have moved blocks (e.g. COPY after some copies)
+    _endCommand(true);
+}
+
+void _CommandWatcher::commandFailed(const ACHAR*) {
+    _endCommand(false);
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static bool _isWatched(const ACHAR* cmdStr) {
+    if (!cmdStr) return false;
+    if (_wcsnicmp(cmdStr, _commandPrefix, wcslen(_commandPrefix)) == 0) return false;
+
+    for (const ACHAR* ignored : _ignoredCommands) {
+        if (_wcsicmp(cmdStr, ignored) == 0) return false;
+    }
+
+    return true;
+}
+
+static void _applyMoves() {
+    if (_moves.empty() || !_pDb) return;
+
+    std::vector<AcDbObjectId> movedIds;
+
+    for (const _Move& move : _moves) {
+        AcDbBlockReference* pBlockRef = nullptr;
+        if (acadOpenObject(pBlockRef, move.id, AcDb::kForRead) != Acad::eOk) continue; // erased
+
+        AcGePoint3d position = pBlockRef->position();
+        acadCloseObject(pBlockRef);
+
+        if (position.x != move.x || position.y != move.y) movedIds.push_back(move.id);
+    }
+
+    if (movedIds.empty()) return;
+
+    CableRecordStore records;
+    records.load(_pDb);
+
+    int cableCount = 0;
+    if (reindexMovedCables(_pDb, movedIds, cableCount, &records) == Acad::eOk && cableCount > 0) {
+        acutPrintf(L"\nRe-indexed %d moved cables.", cableCount);
+    }
+}
+
+static void _clearMoves() {
+    _moves.clear();
+    _noted.clear();
+}
+
+static void _endCommand(bool apply) {
+    // Commands that started before the watcher, such as AUTOREINDEX itself
+    if (_commands.empty()) return;
+
+    bool watched = _commands.front();
+    _commands.pop_back();
+    _watching = !_commands.empty() && std::find(_commands.begin(), _commands.end(), false) == _commands.end();
+
+    if (!_commands.empty()) return;
+
+    // Nothing _applyMoves writes is noted, as _watching is already false
+    if (apply && watched) _applyMoves();
+    _clearMoves();
+}
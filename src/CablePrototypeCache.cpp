@@ -0,0 +1,34 @@
+/**
+ * @file CablePrototypeCache.cpp
+ * @brief Definitions for the CablePrototypeCache class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "CablePrototypeCache.h"
+
+#include <utility>
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+const CablePrototype* CablePrototypeCache::find(const std::wstring& shape) const {
+    auto it = _prototypes.find(shape);
+    return (it != _prototypes.end()) ? &it->second : nullptr;
+}
+
+void CablePrototypeCache::add(const std::wstring& shape, CablePrototype prototype) {
+    _prototypes[shape] = std::move(prototype);
+}
+
+void CablePrototypeCache::clear() {
+    _prototypes.clear();
+}
@@ -0,0 +1,96 @@
+/**
+ * @file CableRecord.cpp
+ * @brief Definitions for the records of drawn cables.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "CableRecord.h"
+
+// -----------------------------------------------------------------------------
+// Internal Constants
+// -----------------------------------------------------------------------------
+
+static const std::uint8_t _version = 1; ///< Version of the packed layout.
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Write a little endian integer of `size` bytes.
+ */
+static void _put(std::uint8_t* data, std::uint32_t value, std::size_t size);
+
+/**
+ * @brief Read a little endian integer of `size` bytes.
+ */
+static std::uint32_t _get(const std::uint8_t* data, std::size_t size);
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+std::vector<CableRecord> getCableRecords(const std::vector<Cable>& cables, const LayoutPlan& plan, const std::wstring& junctionTag) {
+    const std::vector<CablePlacement>& placements = plan.getPlacements();
+
+    std::vector<CableRecord> records;
+    records.reserve(cables.size());
+
+    for (size_t i = 0; i < cables.size() && i < placements.size(); ++i) {
+        CableRecord record;
+        record.junctionTag = junctionTag;
+        record.table = placements[i].table;
+        record.firstTerminal = placements[i].terminal;
+        record.lastTerminal = placements[i].terminal + cables[i].getTerminalFootprint() - 1;
+        record.cableType = cables[i].getCableType();
+
+        records.push_back(record);
+    }
+
+    return records;
+}
+
+PackedCableRecord packCableRecord(const CableRecord& record) {
+    PackedCableRecord data = {};
+
+    data[0] = _version;
+    data[1] = static_cast<std::uint8_t>(record.cableType);
+    _put(&data[2], static_cast<std::uint32_t>(record.table), 2);
+    _put(&data[4], static_cast<std::uint32_t>(record.firstTerminal), 4);
+    _put(&data[8], static_cast<std::uint32_t>(record.lastTerminal), 4);
+
+    return data;
+}
+
+bool unpackCableRecord(const std::uint8_t* data, std::size_t size, CableRecord& record) {
+    if (!data || size != CABLE_RECORD_SIZE || data[0] != _version) return false;
+
+    record.cableType = static_cast<CableType>(data[1]);
+    record.table = static_cast<int>(_get(&data[2], 2));
+    record.firstTerminal = static_cast<std::int32_t>(_get(&data[4], 4));
+    record.lastTerminal = static_cast<std::int32_t>(_get(&data[8], 4));
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static void _put(std::uint8_t* data, std::uint32_t value, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) data[i] = static_cast<std::uint8_t>(value >> (8 * i));
+}
+
+static std::uint32_t _get(const std::uint8_t* data, std::size_t size) {
+    std::uint32_t value = 0;
+    for (std::size_t i = 0; i < size; ++i) value |= static_cast<std::uint32_t>(data[i]) << (8 * i);
+    return value;
+}
@@ -0,0 +1,249 @@
+/**
+ * @file CableRecordStore.cpp
+ * @brief Definitions for the CableRecordStore class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "CableRecordStore.h"
+
+#include <cstring>
+#include <unordered_set>
+
+// -----------------------------------------------------------------------------
+// Internal Constants
+// -----------------------------------------------------------------------------
+
+static const ACHAR* const _dictionaryName = L"GSTCH_CABLES"; ///< Key of the records in the named objects dictionary.
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Build the xrecord data of a cable.
+ *
+ * @return The chain, to be released with `acutRelRb`.
+ */
+static resbuf* _buildChain(const CableRecord& record, const std::vector<AcDbObjectId>& members);
+
+/**
+ * @brief Find the packed record in xrecord data.
+ *
+ * @return The binary chunk, or nullptr if the data has none.
+ */
+static resbuf* _findPacked(resbuf* pChain);
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+Acad::ErrorStatus CableRecordStore::addCables(AcDbDatabase* pDb, const std::vector<CableRecord>& records, const std::vector<std::vector<AcDbObjectId>>& members) {
+    Acad::ErrorStatus es = acadStartTransaction();
+    if (es != Acad::eOk) return es;
+
+    AcDbDictionary* pDict = nullptr;
+    es = acadOpenNamedDictionary(pDb, _dictionaryName, pDict, AcDb::kForWrite, true);
+    if (es != Acad::eOk) {
+        acutPrintf(L"\nError: Could not access the cable records.");
+        acadEndTransaction(false);
+        return es;
+    }
+
+    for (size_t i = 0; i < records.size() && i < members.size(); ++i) {
+        if (members[i].empty() || members[i].front().isNull()) continue;
+
+        // The junction termination's handle is stable across sessions
+        ACHAR key[17];
+        members[i].front().handle().getIntoAsciiBuffer(key, sizeof(key) / sizeof(key[0]));
+
+        resbuf* pChain = _buildChain(records[i], members[i]);
+
+        AcDbXrecord* pXrecord = new AcDbXrecord();
+        es = pXrecord->setFromRbChain(*pChain, pDb);
+        acutRelRb(pChain);
+
+        if (es != Acad::eOk) {
+            delete pXrecord;
+            break;
+        }
+
+        AcDbObjectId recordId;
+        es = acadAddDictionaryObject(pDict, key, pXrecord, recordId);
+        if (es != Acad::eOk) break;
+    }
+
+    acadCloseObject(pDict);
+
+    if (es != Acad::eOk) {
+        acutPrintf(L"\nError: Could not record the drawn cables.");
+        acadEndTransaction(false);
+        return es;
+    }
+
+    return acadEndTransaction();
+}
+
+Acad::ErrorStatus CableRecordStore::readCable(const AcDbObjectId& recordId, CableRecord& record) {
+    AcDbXrecord* pXrecord = nullptr;
+    Acad::ErrorStatus es = acadOpenObject(pXrecord, recordId, AcDb::kForRead);
+    if (es != Acad::eOk) return es;
+
+    resbuf* pChain = nullptr;
+    es = pXrecord->rbChain(&pChain);
+    acadCloseObject(pXrecord);
+    if (es != Acad::eOk) return es;
+
+    resbuf* pPacked = _findPacked(pChain);
+    if (!pPacked || !unpackCableRecord(reinterpret_cast<const std::uint8_t*>(pPacked->resval.rbinary.buf), pPacked->resval.rbinary.clen, record)) {
+        es = Acad::eInvalidInput;
+    }
+
+    for (resbuf* pRb = pChain; pRb && es == Acad::eOk; pRb = pRb->rbnext) {
+        if (pRb->restype == AcDb::kDxfXTextString) record.junctionTag = pRb->resval.rstring;
+    }
+
+    acutRelRb(pChain);
+    return es;
+}
+
+Acad::ErrorStatus CableRecordStore::setFirstTerminal(const AcDbObjectId& recordId, int firstTerminal) {
+    AcDbXrecord* pXrecord = nullptr;
+    Acad::ErrorStatus es = acadOpenObject(pXrecord, recordId, AcDb::kForRead);
+    if (es != Acad::eOk) return es;
+
+    resbuf* pChain = nullptr;
+    es = pXrecord->rbChain(&pChain);
+
+    resbuf* pPacked = (es == Acad::eOk) ? _findPacked(pChain) : nullptr;
+
+    CableRecord record;
+    if (pPacked && unpackCableRecord(reinterpret_cast<const std::uint8_t*>(pPacked->resval.rbinary.buf), pPacked->resval.rbinary.clen, record)) {
+        // Only the terminal range changes, so the chunk is rewritten in place
+        if (record.firstTerminal != firstTerminal) {
+            record.lastTerminal += firstTerminal - record.firstTerminal;
+            record.firstTerminal = firstTerminal;
+
+            PackedCableRecord packed = packCableRecord(record);
+            std::memcpy(pPacked->resval.rbinary.buf, packed.data(), packed.size());
+
+            es = pXrecord->upgradeOpen();
+            if (es == Acad::eOk) es = pXrecord->setFromRbChain(*pChain);
+        }
+    } else if (es == Acad::eOk) {
+        es = Acad::eInvalidInput;
+    }
+
+    if (pChain) acutRelRb(pChain);
+    acadCloseObject(pXrecord);
+
+    return es;
+}
+
+Acad::ErrorStatus CableRecordStore::load(AcDbDatabase* pDb) {
+    _cables.clear();
+    _members.clear();
+
+    AcDbDictionary* pDict = nullptr;
+    Acad::ErrorStatus es = acadOpenNamedDictionary(pDb, _dictionaryName, pDict, AcDb::kForRead);
+    if (es == Acad::eKeyNotFound) return Acad::eOk; // nothing was drawn yet
+    if (es != Acad::eOk) return es;
+
+    AcDbDictionaryIterator* pIter = pDict->newIterator();
+    for (; pIter && !pIter->done(); pIter->next()) {
+        AcDbXrecord* pXrecord = nullptr;
+        if (acadOpenObject(pXrecord, pIter->objectId(), AcDb::kForRead) != Acad::eOk) continue;
+
+        resbuf* pChain = nullptr;
+        if (pXrecord->rbChain(&pChain) == Acad::eOk) {
+            std::vector<AcDbObjectId>& members = _members[pIter->objectId()];
+
+            for (resbuf* pRb = pChain; pRb; pRb = pRb->rbnext) {
+                if (pRb->restype != AcDb::kDxfSoftPointerId) continue;
+
+                AcDbObjectId memberId;
+                if (acdbGetObjectId(memberId, pRb->resval.rlname) != Acad::eOk) continue;
+
+                members.push_back(memberId);
+                _cables[memberId] = pIter->objectId();
+            }
+
+            acutRelRb(pChain);
+        }
+
+        acadCloseObject(pXrecord);
+    }
+
+    delete pIter;
+    acadCloseObject(pDict);
+
+    return Acad::eOk;
+}
+
+AcDbObjectId CableRecordStore::findCable(const AcDbObjectId& memberId) const {
+    auto it = _cables.find(memberId);
+    return (it != _cables.end()) ? it->second : AcDbObjectId::kNull;
+}
+
+const std::vector<AcDbObjectId>& CableRecordStore::getMembers(const AcDbObjectId& recordId) const {
+    static const std::vector<AcDbObjectId> none;
+
+    auto it = _members.find(recordId);
+    return (it != _members.end()) ? it->second : none;
+}
+
+void CableRecordStore::expandToCables(std::vector<AcDbObjectId>& objIds) const {
+    if (_cables.empty()) return;
+
+    std::unordered_set<AcDbObjectId, AcadObjectIdHash> selected(objIds.begin(), objIds.end());
+
+    size_t count = objIds.size();
+    for (size_t i = 0; i < count; ++i) {
+        auto cable = _cables.find(objIds[i]);
+        if (cable == _cables.end()) continue;
+
+        for (const AcDbObjectId& memberId : _members.at(cable->second)) {
+            if (selected.insert(memberId).second) objIds.push_back(memberId);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static resbuf* _buildChain(const CableRecord& record, const std::vector<AcDbObjectId>& members) {
+    PackedCableRecord packed = packCableRecord(record);
+
+    resbuf* pHead = acutNewRb(AcDb::kDxfBinaryChunk);
+    pHead->resval.rbinary.clen = static_cast<short>(packed.size());
+    pHead->resval.rbinary.buf = static_cast<char*>(acad_malloc(packed.size()));
+    std::memcpy(pHead->resval.rbinary.buf, packed.data(), packed.size());
+
+    resbuf* pTail = pHead->rbnext = acutNewRb(AcDb::kDxfXTextString);
+    acutNewString(record.junctionTag.c_str(), pTail->resval.rstring);
+
+    for (const AcDbObjectId& memberId : members) {
+        if (memberId.isNull()) continue;
+
+        pTail = pTail->rbnext = acutNewRb(AcDb::kDxfSoftPointerId);
+        acdbGetAdsName(pTail->resval.rlname, memberId);
+    }
+
+    return pHead;
+}
+
+static resbuf* _findPacked(resbuf* pChain) {
+    for (resbuf* pRb = pChain; pRb; pRb = pRb->rbnext) {
+        if (pRb->restype == AcDb::kDxfBinaryChunk) return pRb;
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,462 @@
+/**
+ * @file CableReindex.cpp
+ * @brief Definitions for renumbering the terminals of drawn cables.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "CableReindex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "BlockKindCache.h"
+#include "Drawing.h"
+#include "TableReindex.h"
+
+// -----------------------------------------------------------------------------
+// Internal Constants
+// -----------------------------------------------------------------------------
+
+static const double _terminalPitch = 0.25; ///< Vertical distance between two terminals.
+
+// -----------------------------------------------------------------------------
+// Internal Types
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief A selected termination block.
+ */
+struct _Termination {
+    AcDbObjectId id;        ///< The block reference.
+    bool junction;          ///< true for a Junction Termination, false for a Field Device Termination.
+    CableType cableType;    ///< WIRE7 for the 7 wire blocks, PAIR1 for the others.
+    double y;               ///< Height of the insertion point.
+};
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Get whether a block is a termination, and of which cable type.
+ *
+ * @return true if the block is a termination, false otherwise.
+ */
+static bool _terminationKind(BlockKind blockKind, bool& junction, CableType& cableType);
+
+/**
+ * @brief Rewrite the terminal numbers of a block's FLDTAG attributes.
+ *
+ * Every attribute is visited once. A FLDTAG is only opened for write if its
+ * text changes, and tags without a "(" are left alone.
+ *
+ * @param pBlockRef     The termination, open for read.
+ * @param cableType     Type of the cable, which decides the gaps between wires.
+ * @param firstTerminal Terminal of FLDTAG1.
+ */
+static void _updateFieldTags(AcDbBlockReference* pBlockRef, CableType cableType, int firstTerminal);
+
+/**
+ * @brief Get the number of a FLDTAG attribute.
+ *
+ * @return The n of FLDTAGn, or 0 if the tag is not a field tag.
+ */
+static int _fieldTagNumber(const ACHAR* tag);
+
+/**
+ * @brief Read the text of a block's FLDTAG attributes.
+ *
+ * @param pBlockRef The termination, open for read.
+ * @param fieldTags Receives the text of FLDTAG1, FLDTAG2, ... in order.
+ */
+static void _readFieldTags(AcDbBlockReference* pBlockRef, std::vector<std::wstring>& fieldTags);
+
+/**
+ * @brief Write the changed field tags of a block in one pass over its attributes.
+ *
+ * @param pBlockRef The termination, open for read.
+ * @param begin     First update of the block.
+ * @param end       One past the last update of the block.
+ */
+static void _writeFieldTags(AcDbBlockReference* pBlockRef, const FieldTagUpdate* begin, const FieldTagUpdate* end);
+
+/**
+ * @brief Read a block if it is a termination.
+ *
+ * @param objId     The block reference.
+ * @param kindCache Block kinds of the current command.
+ * @param block     Receives the kind, position and FLDTAG attributes of the block.
+ * @return          false if the block is not a termination.
+ */
+static bool _readTermination(const AcDbObjectId& objId, BlockKindCache& kindCache, ReindexBlock& block);
+
+/**
+ * @brief Write the updates of a renumbering, opening each changed block once.
+ *
+ * @param ids     The block reference of each block the updates refer to.
+ * @param updates The updates, sorted by block.
+ */
+static void _writeUpdates(const std::vector<AcDbObjectId>& ids, const std::vector<FieldTagUpdate>& updates);
+
+/**
+ * @brief Move the record of a junction termination's cable to a new first terminal.
+ *
+ * Terminations of cables that were not recorded are ignored.
+ */
+static void _moveRecord(const CableRecordStore& records, const AcDbObjectId& terminationId, int firstTerminal);
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+Acad::ErrorStatus reindexCables(const std::vector<AcDbObjectId>& objIds, int startingTerminal, int& cableCount, const CableRecordStore* pRecords) {
+    cableCount = 0;
+
+    Acad::ErrorStatus es = acadStartTransaction();
+    if (es != Acad::eOk) return es;
+
+    // Resolve each block's kind and height once, and each definition's name
+    // only for its first reference
+    BlockKindCache kindCache;
+    std::vector<_Termination> terminations;
+    terminations.reserve(objIds.size());
+
+    for (const AcDbObjectId& objId : objIds) {
+        AcDbBlockReference* pBlockRef = nullptr;
+        if (acadOpenObject(pBlockRef, objId, AcDb::kForRead) != Acad::eOk) continue; // not a block
+
+        BlockKind blockKind;
+        if (kindCache.getKind(pBlockRef, blockKind) != Acad::eOk) continue; // skip if we can't resolve name
+
+        _Termination termination;
+        if (!_terminationKind(blockKind, termination.junction, termination.cableType)) continue;
+
+        termination.id = objId;
+        termination.y = pBlockRef->position().y;
+
+        terminations.push_back(termination);
+    }
+
+    // Top to bottom, so the highest junction termination is the first one
+    std::stable_sort(terminations.begin(), terminations.end(), [](const _Termination& a, const _Termination& b) {
+        return a.y > b.y;
+    });
+
+    auto highest = std::find_if(terminations.begin(), terminations.end(), [](const _Termination& termination) {
+        return termination.junction;
+    });
+
+    if (highest == terminations.end()) {
+        acadEndTransaction();
+        return Acad::eOk;
+    }
+
+    double top = highest->y;
+
+    for (const _Termination& termination : terminations) {
+        int terminalDif = static_cast<int>(std::round((top - termination.y) / _terminalPitch));
+
+        AcDbBlockReference* pBlockRef = nullptr;
+        if (acadOpenObject(pBlockRef, termination.id, AcDb::kForRead) != Acad::eOk) continue;
+
+        _updateFieldTags(pBlockRef, termination.cableType, startingTerminal + terminalDif);
+
+        if (!termination.junction) continue;
+
+        if (pRecords) _moveRecord(*pRecords, termination.id, startingTerminal + terminalDif);
+        cableCount++;
+    }
+
+    return acadEndTransaction();
+}
+
+Acad::ErrorStatus reindexAllCables(const std::vector<AcDbObjectId>& objIds, int& tableCount, int& cableCount, const CableRecordStore* pRecords) {
+    tableCount = 0;
+    cableCount = 0;
+
+    Acad::ErrorStatus es = acadStartTransaction();
+    if (es != Acad::eOk) return es;
+
+    // Read every termination once
+    BlockKindCache kindCache;
+    std::vector<AcDbObjectId> ids;
+    std::vector<ReindexBlock> blocks;
+
+    for (const AcDbObjectId& objId : objIds) {
+        ReindexBlock block;
+        if (!_readTermination(objId, kindCache, block)) continue;
+
+        ids.push_back(objId);
+        blocks.push_back(std::move(block));
+    }
+
+    ReindexResult result = reindexTables(blocks);
+
+    _writeUpdates(ids, result.updates);
+
+    if (pRecords) {
+        for (const ReindexTable& table : result.tables) {
+            for (size_t t : table.terminations) {
+                _moveRecord(*pRecords, ids[t], result.firstTerminals[t]);
+            }
+        }
+    }
+
+    tableCount = static_cast<int>(result.tables.size());
+    cableCount = static_cast<int>(result.cableCount);
+
+    return acadEndTransaction();
+}
+
+Acad::ErrorStatus reindexMovedCables(AcDbDatabase* pDb, const std::vector<AcDbObjectId>& movedIds, int& cableCount, const CableRecordStore* pRecords) {
+    cableCount = 0;
+    if (!pDb) return Acad::eNullObjectPointer;
+
+    Acad::ErrorStatus es = acadStartTransaction();
+    if (es != Acad::eOk) return es;
+
+    BlockKindCache kindCache;
+    std::unordered_set<AcDbObjectId, AcadObjectIdHash> moved;
+
+    for (const AcDbObjectId& objId : movedIds) {
+        ReindexBlock block;
+        if (_readTermination(objId, kindCache, block)) moved.insert(objId);
+    }
+
+    if (moved.empty()) return acadEndTransaction();
+
+    // The unmoved terminations of the same tables are anywhere in model space
+    AcDbBlockTable* pBlockTable = nullptr;
+    AcDbObjectId modelSpaceId;
+    AcDbBlockTableRecord* pModelSpace = nullptr;
+    if (acadOpenObject(pBlockTable, pDb->blockTableId(), AcDb::kForRead) != Acad::eOk ||
+        pBlockTable->getAt(ACDB_MODEL_SPACE, modelSpaceId) != Acad::eOk ||
+        acadOpenObject(pModelSpace, modelSpaceId, AcDb::kForRead) != Acad::eOk) {
+        acadEndTransaction(false);
+        return Acad::eNullObjectPointer;
+    }
+
+    AcDbBlockTableRecordIterator* pIter = nullptr;
+    pModelSpace->newIterator(pIter);
+
+    std::vector<AcDbObjectId> ids;
+    std::vector<ReindexBlock> blocks;
+    std::vector<bool> blockMoved;
+
+    for (; pIter && !pIter->done(); pIter->step()) {
+        AcDbObjectId objId;
+        if (pIter->getEntityId(objId) != Acad::eOk) continue;
+
+        ReindexBlock block;
+        if (!_readTermination(objId, kindCache, block)) continue;
+
+        ids.push_back(objId);
+        blocks.push_back(std::move(block));
+        blockMoved.push_back(moved.count(objId) > 0);
+    }
+
+    delete pIter;
+
+    // Recorded cables know their field device termination; the others are found from the drawing
+    std::vector<size_t> fieldDevices;
+
+    if (pRecords) {
+        std::unordered_map<AcDbObjectId, size_t, AcadObjectIdHash> indices;
+        for (size_t i = 0; i < ids.size(); ++i) indices[ids[i]] = i;
+
+        fieldDevices.assign(blocks.size(), UNRECORDED_BLOCK);
+
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            bool junction = false;
+            CableType cableType;
+            if (!blockMoved[i] || !_terminationKind(blocks[i].kind, junction, cableType) || !junction) continue;
+
+            AcDbObjectId recordId = pRecords->findCable(ids[i]);
+            if (recordId.isNull()) continue;
+
+            for (const AcDbObjectId& memberId : pRecords->getMembers(recordId)) {
+                auto it = indices.find(memberId);
+                if (it != indices.end() && _terminationKind(blocks[it->second].kind, junction, cableType) && !junction) fieldDevices[i] = it->second;
+            }
+        }
+    }
+
+    ReindexResult result = reindexMoved(blocks, blockMoved, fieldDevices);
+    _writeUpdates(ids, result.updates);
+
+    if (pRecords) {
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            bool junction = false;
+            CableType cableType;
+            if (result.firstTerminals[i] != 0 && _terminationKind(blocks[i].kind, junction, cableType) && junction) {
+                _moveRecord(*pRecords, ids[i], result.firstTerminals[i]);
+            }
+        }
+    }
+
+    cableCount = static_cast<int>(result.cableCount);
+
+    return acadEndTransaction();
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static bool _terminationKind(BlockKind blockKind, bool& junction, CableType& cableType) {
+    switch (blockKind)
+    {
+    case BlockKind::JUNCTION_TERM :
+    case BlockKind::FIELD_DEV_TERM :
+        cableType = CableType::PAIR1;
+        break;
+
+    case BlockKind::JUNCTION_TERM7 :
+    case BlockKind::FIELD_DEV_TERM7 :
+        cableType = CableType::WIRE7;
+        break;
+
+    default:
+        return false;
+    }
+
+    junction = blockKind == BlockKind::JUNCTION_TERM || blockKind == BlockKind::JUNCTION_TERM7;
+    return true;
+}
+
+static void _updateFieldTags(AcDbBlockReference* pBlockRef, CableType cableType, int firstTerminal) {
+    int fieldTagCount = getFieldTagCount(cableType);
+
+    AcDbObjectIterator* pIter = pBlockRef->attributeIterator();
+    if (!pIter) return;
+
+    for (; !pIter->done(); pIter->step()) {
+        AcDbAttribute* pAtt = nullptr;
+        if (acadOpenObject(pAtt, pIter->objectId(), AcDb::kForRead) != Acad::eOk) continue;
+
+        int fieldTag = _fieldTagNumber(pAtt->tag());
+
+        if (fieldTag >= 1 && fieldTag <= fieldTagCount) {
+            std::wstring fldtag = pAtt->textString();
+
+            size_t paren = fldtag.find(L'(');
+            if (paren != std::wstring::npos) {
+                int terminal = getFieldTagTerminal(cableType, firstTerminal, fieldTag);
+                std::wstring renumbered = fldtag.substr(0, paren) + L"(" + std::to_wstring(terminal) + L")";
+
+                if (renumbered != fldtag && pAtt->upgradeOpen() == Acad::eOk) {
+                    pAtt->setTextString(renumbered.c_str());
+                    pAtt->adjustAlignment();
+                }
+            }
+        }
+
+        acadCloseObject(pAtt);
+    }
+
+    delete pIter;
+}
+
+static int _fieldTagNumber(const ACHAR* tag) {
+    static const size_t prefixLength = 6; // "FLDTAG"
+
+    return (wcsncmp(tag, L"FLDTAG", prefixLength) == 0) ? _wtoi(tag + prefixLength) : 0;
+}
+
+static void _readFieldTags(AcDbBlockReference* pBlockRef, std::vector<std::wstring>& fieldTags) {
+    AcDbObjectIterator* pIter = pBlockRef->attributeIterator();
+    if (!pIter) return;
+
+    for (; !pIter->done(); pIter->step()) {
+        AcDbAttribute* pAtt = nullptr;
+        if (acadOpenObject(pAtt, pIter->objectId(), AcDb::kForRead) != Acad::eOk) continue;
+
+        int fieldTag = _fieldTagNumber(pAtt->tag());
+        if (fieldTag >= 1) {
+            if (fieldTags.size() < static_cast<size_t>(fieldTag)) fieldTags.resize(fieldTag);
+            fieldTags[fieldTag - 1] = pAtt->textString();
+        }
+
+        acadCloseObject(pAtt);
+    }
+
+    delete pIter;
+}
+
+static void _writeFieldTags(AcDbBlockReference* pBlockRef, const FieldTagUpdate* begin, const FieldTagUpdate* end) {
+    AcDbObjectIterator* pIter = pBlockRef->attributeIterator();
+    if (!pIter) return;
+
+    for (; !pIter->done(); pIter->step()) {
+        AcDbAttribute* pAtt = nullptr;
+        if (acadOpenObject(pAtt, pIter->objectId(), AcDb::kForRead) != Acad::eOk) continue;
+
+        int fieldTag = _fieldTagNumber(pAtt->tag());
+
+        const FieldTagUpdate* pUpdate = std::find_if(begin, end, [&](const FieldTagUpdate& update) {
+            return update.fieldTag == fieldTag;
+        });
+
+        if (pUpdate != end && pAtt->upgradeOpen() == Acad::eOk) {
+            pAtt->setTextString(pUpdate->text.c_str());
+            pAtt->adjustAlignment();
+        }
+
+        acadCloseObject(pAtt);
+    }
+
+    delete pIter;
+}
+
+static bool _readTermination(const AcDbObjectId& objId, BlockKindCache& kindCache, ReindexBlock& block) {
+    AcDbBlockReference* pBlockRef = nullptr;
+    if (acadOpenObject(pBlockRef, objId, AcDb::kForRead) != Acad::eOk) return false; // not a block
+
+    if (kindCache.getKind(pBlockRef, block.kind) != Acad::eOk) return false; // skip if we can't resolve name
+
+    bool junction = false;
+    CableType cableType;
+    if (!_terminationKind(block.kind, junction, cableType)) return false;
+
+    AcGePoint3d position = pBlockRef->position();
+    block.x = position.x;
+    block.y = position.y;
+
+    _readFieldTags(pBlockRef, block.fieldTags);
+
+    return true;
+}
+
+static void _writeUpdates(const std::vector<AcDbObjectId>& ids, const std::vector<FieldTagUpdate>& updates) {
+    // The updates are sorted by block, so each block is opened once
+    const FieldTagUpdate* pUpdates = updates.data();
+    size_t updateCount = updates.size();
+
+    for (size_t first = 0; first < updateCount;) {
+        size_t last = first;
+        while (last < updateCount && pUpdates[last].block == pUpdates[first].block) last++;
+
+        AcDbBlockReference* pBlockRef = nullptr;
+        if (acadOpenObject(pBlockRef, ids[pUpdates[first].block], AcDb::kForRead) == Acad::eOk) {
+            _writeFieldTags(pBlockRef, pUpdates + first, pUpdates + last);
+        }
+
+        first = last;
+    }
+}
+
+static void _moveRecord(const CableRecordStore& records, const AcDbObjectId& terminationId, int firstTerminal) {
+    AcDbObjectId recordId = records.findCable(terminationId);
+    if (!recordId.isNull()) CableRecordStore::setFirstTerminal(recordId, firstTerminal);
+}
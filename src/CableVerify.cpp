@@ -0,0 +1,257 @@
+/**
+ * @file CableVerify.cpp
+ * @brief Definitions for checking drawn cables against the workbook.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "CableVerify.h"
+
+#include <algorithm>
+#include <tuple>
+
+// -----------------------------------------------------------------------------
+// Internal Constants
+// -----------------------------------------------------------------------------
+
+static const std::uint64_t _fnvOffset = 14695981039346656037ULL;   ///< FNV-1a 64-bit offset basis.
+static const std::uint64_t _fnvPrime = 1099511628211ULL;           ///< FNV-1a 64-bit prime.
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Add an integer to a hash, as four little endian bytes.
+ */
+static void _hash(std::uint64_t& hash, std::uint32_t value);
+
+/**
+ * @brief Add a string to a hash, as its length then its characters.
+ *
+ * Each character is added as an integer, so the hash does not depend on the
+ * size of wchar_t.
+ */
+static void _hash(std::uint64_t& hash, const std::wstring& text);
+
+/**
+ * @brief Order signatures by junction tag, cable label, then position.
+ */
+static bool _signatureLess(const CableSignature& a, const CableSignature& b);
+
+/**
+ * @brief Check whether two signatures are of the same junction tag and cable label.
+ */
+static bool _sameCable(const CableSignature& a, const CableSignature& b);
+
+/**
+ * @brief Compare the signatures of one junction tag and cable label.
+ */
+static void _compareGroup(const CableSignature* expected, size_t expectedCount, const CableSignature* drawn, size_t drawnCount, std::vector<CableMismatch>& mismatches);
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+CableSignature signCable(const DrawnCable& cable) {
+    CableSignature signature;
+    signature.junctionTag = cable.junctionTag;
+    signature.cableLabel = cable.cableLabel;
+    signature.table = cable.table;
+    signature.firstTerminal = cable.firstTerminal;
+
+    std::uint64_t hash = _fnvOffset;
+    _hash(hash, cable.visibility);
+    _hash(hash, cable.cableLabel);
+    _hash(hash, static_cast<std::uint32_t>(cable.table));
+    _hash(hash, static_cast<std::uint32_t>(cable.firstTerminal));
+    _hash(hash, static_cast<std::uint32_t>(cable.devices.size()));
+
+    for (const auto& device : cable.devices) {
+        _hash(hash, device.first);
+        _hash(hash, static_cast<std::uint32_t>(device.second));
+    }
+
+    signature.hash = hash;
+    return signature;
+}
+
+std::vector<DrawnCable> getPlannedCables(const std::vector<Cable>& cables, const LayoutPlan& plan, const std::wstring& junctionTag) {
+    std::vector<DrawnCable> planned;
+    planned.reserve(cables.size());
+
+    for (size_t i = 0; i < cables.size(); ++i) {
+        const Cable& cable = cables[i];
+
+        DrawnCable drawn;
+        drawn.junctionTag = junctionTag;
+        drawn.table = plan[i].table;
+        drawn.firstTerminal = plan[i].terminal;
+        drawn.visibility = cable.getVisState();
+
+        std::vector<Device> devices = cable.getDevices();
+        if (!devices.empty()) drawn.cableLabel = getCableLabel(cable);
+
+        for (const Device& device : devices) {
+            std::string tag = device.getCombinedTag();
+            drawn.devices.emplace_back(std::wstring(tag.begin(), tag.end()), device.getTerminalFootprint());
+        }
+
+        planned.push_back(std::move(drawn));
+    }
+
+    return planned;
+}
+
+std::vector<CableMismatch> compareSignatures(std::vector<CableSignature> expected, std::vector<CableSignature> drawn) {
+    std::sort(expected.begin(), expected.end(), _signatureLess);
+    std::sort(drawn.begin(), drawn.end(), _signatureLess);
+
+    std::vector<CableMismatch> mismatches;
+
+    // Walk both lists one cable label at a time
+    size_t e = 0;
+    size_t d = 0;
+    while (e < expected.size() || d < drawn.size()) {
+        const CableSignature& next = (d == drawn.size() || (e < expected.size() && _signatureLess(expected[e], drawn[d]))) ? expected[e] : drawn[d];
+
+        size_t expectedEnd = e;
+        while (expectedEnd < expected.size() && _sameCable(expected[expectedEnd], next)) expectedEnd++;
+
+        size_t drawnEnd = d;
+        while (drawnEnd < drawn.size() && _sameCable(drawn[drawnEnd], next)) drawnEnd++;
+
+        _compareGroup(expected.data() + e, expectedEnd - e, drawn.data() + d, drawnEnd - d, mismatches);
+
+        e = expectedEnd;
+        d = drawnEnd;
+    }
+
+    return mismatches;
+}
+
+std::vector<CableMismatch> verifyJunction(std::vector<Cable> cables, const std::wstring& junctionTag, const std::vector<CableSignature>& drawn) {
+    // Same order as _drawJunctionBox
+    std::sort(cables.begin(), cables.end());
+
+    static const BoxSize sizes[] = { BoxSize::LARGE, BoxSize::MEDIUM, BoxSize::SMALL, BoxSize::CUSTOM };
+
+    std::vector<CableMismatch> best;
+    bool found = false;
+
+    for (BoxSize size : sizes) {
+        LayoutPlan plan = LayoutPlanner(size).plan(cables);
+        if (size != BoxSize::CUSTOM && plan.overflows()) continue;
+
+        std::vector<CableSignature> expected;
+        expected.reserve(cables.size());
+        for (const DrawnCable& cable : getPlannedCables(cables, plan, junctionTag)) {
+            expected.push_back(signCable(cable));
+        }
+
+        std::vector<CableMismatch> mismatches = compareSignatures(std::move(expected), drawn);
+        if (!found || mismatches.size() < best.size()) {
+            best = std::move(mismatches);
+            found = true;
+        }
+
+        if (best.empty()) break;
+    }
+
+    return best;
+}
+
+std::vector<CableMismatch> verifyTerminalTable(const CableLookup& getCables, const TerminalTable& table) {
+    std::vector<CableMismatch> mismatches;
+
+    // The drawn cables are already grouped by junction tag
+    size_t start = 0;
+    while (start < table.cables.size()) {
+        const std::wstring& junctionTag = table.cables[start].junctionTag;
+
+        std::vector<CableSignature> drawn;
+        size_t end = start;
+        for (; end < table.cables.size() && table.cables[end].junctionTag == junctionTag; ++end) {
+            drawn.push_back(signCable(table.cables[end]));
+        }
+
+        std::string tag;
+        for (wchar_t c : junctionTag) tag += (static_cast<unsigned long>(c) < 128) ? static_cast<char>(c) : '?';
+
+        std::vector<CableMismatch> junctionMismatches = verifyJunction(getCables(tag), junctionTag, drawn);
+        mismatches.insert(mismatches.end(), junctionMismatches.begin(), junctionMismatches.end());
+
+        start = end;
+    }
+
+    return mismatches;
+}
+
+std::vector<CableMismatch> verifyTerminalTable(const Workbook& workbook, const TerminalTable& table) {
+    return verifyTerminalTable([&workbook](const std::string& junctionTag) { return workbook.getCables(junctionTag); }, table);
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static void _hash(std::uint64_t& hash, std::uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        hash ^= (value >> (8 * i)) & 0xFF;
+        hash *= _fnvPrime;
+    }
+}
+
+static void _hash(std::uint64_t& hash, const std::wstring& text) {
+    _hash(hash, static_cast<std::uint32_t>(text.size()));
+    for (wchar_t c : text) _hash(hash, static_cast<std::uint32_t>(c));
+}
+
+static bool _signatureLess(const CableSignature& a, const CableSignature& b) {
+    return std::tie(a.junctionTag, a.cableLabel, a.table, a.firstTerminal) < std::tie(b.junctionTag, b.cableLabel, b.table, b.firstTerminal);
+}
+
+static bool _sameCable(const CableSignature& a, const CableSignature& b) {
+    return a.junctionTag == b.junctionTag && a.cableLabel == b.cableLabel;
+}
+
+static void _compareGroup(const CableSignature* expected, size_t expectedCount, const CableSignature* drawn, size_t drawnCount, std::vector<CableMismatch>& mismatches) {
+    std::vector<bool> expectedMatched(expectedCount, false);
+    std::vector<bool> drawnMatched(drawnCount, false);
+
+    // Identical cables first, so a repeated label only reports the stale ones
+    for (size_t e = 0; e < expectedCount; ++e) {
+        for (size_t d = 0; d < drawnCount; ++d) {
+            if (drawnMatched[d] || expected[e].hash != drawn[d].hash) continue;
+
+            expectedMatched[e] = true;
+            drawnMatched[d] = true;
+            break;
+        }
+    }
+
+    size_t d = 0;
+    for (size_t e = 0; e < expectedCount; ++e) {
+        if (expectedMatched[e]) continue;
+
+        while (d < drawnCount && drawnMatched[d]) d++;
+
+        if (d < drawnCount) {
+            mismatches.push_back({ MismatchKind::CHANGED, expected[e], drawn[d] });
+            drawnMatched[d] = true;
+        } else {
+            mismatches.push_back({ MismatchKind::MISSING, expected[e], CableSignature() });
+        }
+    }
+
+    for (d = 0; d < drawnCount; ++d) {
+        if (!drawnMatched[d]) mismatches.push_back({ MismatchKind::EXTRA, CableSignature(), drawn[d] });
+    }
+}
@@ -25,72 +25,6 @@ Device::Device(std::string combinedTag, int footprint)
     _footprint = footprint;
 }
 
-void Device::draw(AcGePoint3d origin, bool flip) const {
-    AcGePoint3d termOrigin = origin + AcGeVector3d(-0.3438 * (flip ? -1 : 1), 0.125, 0.0);
-
-    static const AcGeVector3d termOffset(0.0, -0.25, 0.0);
-
-    AcDbObjectId term1Id = acadInsertBlock(L"TBWIREMINI", termOrigin);
-    AcDbObjectId term2Id = acadInsertBlock(L"TBWIREMINI", termOrigin + termOffset);
-
-    acadSetBlockAttribute(term1Id, L"#", L"+");
-    acadSetBlockAttribute(term2Id, L"#", L"-");
-
-    acadSetObjectProperty(term1Id, AcDb::kDxfLayerName, L"ELECTRICAL - LIGHT");
-    acadSetObjectProperty(term2Id, AcDb::kDxfLayerName, L"ELECTRICAL - LIGHT");
-
-    acadSetObjectScale(term1Id, AcGeScale3d(flip ? -1 : 1, 1.0, 1.0));
-    acadSetObjectScale(term2Id, AcGeScale3d(flip ? -1 : 1, 1.0, 1.0));
-
-    AcGeVector3d symbolOffset(-0.9375, -0.125, 0.0);
-    if (flip) symbolOffset.x *= -1;
-
-    if (_footprint == 4) {
-        // TRIAD
-
-        AcDbObjectId term3Id = acadInsertBlock(L"TBWIREMINI", termOrigin + termOffset * 2);
-
-        acadSetBlockAttribute(term3Id, L"#", L"REF");
-
-        acadSetObjectProperty(term3Id, AcDb::kDxfLayerName, L"ELECTRICAL - LIGHT");
-
-        acadSetObjectScale(term3Id, AcGeScale3d(flip ? -1 : 1, 1.0, 1.0));
-
-        symbolOffset.y = -0.25;
-    }
-
-    if (_footprint == 6) {
-        // 2 pair
-
-        AcDbObjectId term3Id = acadInsertBlock(L"TBWIREMINI", termOrigin + termOffset * 3);
-        AcDbObjectId term4Id = acadInsertBlock(L"TBWIREMINI", termOrigin + termOffset * 4);
-
-        acadSetBlockAttribute(term1Id, L"#", L"L");
-        acadSetBlockAttribute(term2Id, L"#", L"N");
-        acadSetBlockAttribute(term3Id, L"#", L"5");
-        acadSetBlockAttribute(term4Id, L"#", L"6");
-
-        acadSetObjectProperty(term3Id, AcDb::kDxfLayerName, L"ELECTRICAL - LIGHT");
-        acadSetObjectProperty(term4Id, AcDb::kDxfLayerName, L"ELECTRICAL - LIGHT");
-
-        acadSetObjectScale(term3Id, AcGeScale3d(flip ? -1 : 1, 1.0, 1.0));
-        acadSetObjectScale(term4Id, AcGeScale3d(flip ? -1 : 1, 1.0, 1.0));
-
-        symbolOffset.y = -0.5;
-    }
-
-    // Draw the symbol
-    AcDbObjectId symbolId = acadInsertBlock(L"INST SYMBOL", origin + symbolOffset);
-
-    std::wstring tag_W(_tag.begin(), _tag.end());
-    std::wstring number_W(_number.begin(), _number.end());
-
-    acadSetBlockAttribute(symbolId, L"TAG", tag_W.c_str());
-    acadSetBlockAttribute(symbolId, L"NUMBER", number_W.c_str());
-
-    acadSetDynBlockProperty(symbolId, L"Flip state", (short)(flip ? 1 : 0));
-}
-
 std::string Device::getTag() const {
     return _tag;
 }
@@ -0,0 +1,130 @@
+/**
+ * @file DrawBuffer.cpp
+ * @brief Definitions for the DrawBuffer class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "DrawBuffer.h"
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+std::uint32_t DrawBuffer::insertBlock(const std::wstring& blockName, LayoutPoint origin) {
+    DrawCommand command{ DrawOp::INSERT_BLOCK };
+    command.block = _blockCount;
+    command.name = _intern(blockName);
+    command.x = origin.x;
+    command.y = origin.y;
+    _commands.push_back(command);
+
+    return _blockCount++;
+}
+
+void DrawBuffer::setAttribute(std::uint32_t block, const std::wstring& tag, const std::wstring& value) {
+    DrawCommand command{ DrawOp::SET_ATTRIBUTE };
+    command.block = block;
+    command.name = _intern(tag);
+    command.text = _append(value);
+    _commands.push_back(command);
+}
+
+void DrawBuffer::setProperty(std::uint32_t block, const std::wstring& property, short value) {
+    DrawCommand command{ DrawOp::SET_PROPERTY, DrawValueType::SHORT };
+    command.block = block;
+    command.name = _intern(property);
+    command.x = value;
+    _commands.push_back(command);
+}
+
+void DrawBuffer::setProperty(std::uint32_t block, const std::wstring& property, double value) {
+    DrawCommand command{ DrawOp::SET_PROPERTY, DrawValueType::DOUBLE };
+    command.block = block;
+    command.name = _intern(property);
+    command.x = value;
+    _commands.push_back(command);
+}
+
+void DrawBuffer::setProperty(std::uint32_t block, const std::wstring& property, const std::wstring& value) {
+    DrawCommand command{ DrawOp::SET_PROPERTY, DrawValueType::STRING };
+    command.block = block;
+    command.name = _intern(property);
+    command.text = _intern(value); // Property values (e.g. visibility states) repeat a lot
+    _commands.push_back(command);
+}
+
+void DrawBuffer::setLayer(std::uint32_t block, const std::wstring& layer) {
+    DrawCommand command{ DrawOp::SET_LAYER };
+    command.block = block;
+    command.name = _intern(layer);
+    _commands.push_back(command);
+}
+
+void DrawBuffer::setScale(std::uint32_t block, double x, double y, double z) {
+    DrawCommand command{ DrawOp::SET_SCALE };
+    command.block = block;
+    command.x = x;
+    command.y = y;
+    command.z = z;
+    _commands.push_back(command);
+}
+
+void DrawBuffer::beginGroup(const std::wstring& shape, LayoutPoint origin) {
+    DrawCommand command{ DrawOp::BEGIN_GROUP };
+    command.block = _blockCount;
+    command.name = _intern(shape);
+    command.x = origin.x;
+    command.y = origin.y;
+    _commands.push_back(command);
+}
+
+void DrawBuffer::endGroup() {
+    DrawCommand command{ DrawOp::END_GROUP };
+    command.block = _blockCount;
+    _commands.push_back(command);
+}
+
+const std::vector<DrawCommand>& DrawBuffer::getCommands() const {
+    return _commands;
+}
+
+const std::wstring& DrawBuffer::getString(std::uint32_t index) const {
+    return _strings.at(index);
+}
+
+std::uint32_t DrawBuffer::getBlockCount() const {
+    return _blockCount;
+}
+
+void DrawBuffer::clear() {
+    _commands.clear();
+    _strings.clear();
+    _names.clear();
+    _blockCount = 0;
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+std::uint32_t DrawBuffer::_intern(const std::wstring& name) {
+    auto it = _names.find(name);
+    if (it != _names.end()) return it->second;
+
+    std::uint32_t index = _append(name);
+    _names.emplace(name, index);
+    return index;
+}
+
+std::uint32_t DrawBuffer::_append(const std::wstring& text) {
+    _strings.push_back(text);
+    return static_cast<std::uint32_t>(_strings.size() - 1);
+}
@@ -0,0 +1,246 @@
+/**
+ * @file Drawing.cpp
+ * @brief Definitions for recording the draw commands of cables and devices.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "Drawing.h"
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Get the group shape of a cable.
+ *
+ * @return A key that is equal for cables whose blocks differ only in position
+ *         and attribute text.
+ */
+static std::wstring _cableShape(const Cable& cable, bool flip);
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+void drawCable(DrawBuffer& buffer, const Cable& cable, LayoutPoint origin, int terminalNumber, bool flip, const std::wstring& junctionTag, int tableNumber) {
+    std::vector<Device> devices = cable.getDevices();
+    std::wstring visState = cable.getVisState();
+
+    double fldDevOffset = flip ? 9.0 : -9.0;
+    LayoutPoint fldDevOrigin = { origin.x + fldDevOffset, origin.y };
+
+    buffer.beginGroup(_cableShape(cable, flip), origin);
+
+    std::uint32_t junctionTerm;
+    std::uint32_t fldDevTerm;
+
+    // 7-Wire cables have their own block
+    if (cable.getCableType() == CableType::WIRE7) {
+        junctionTerm = buffer.insertBlock(L"Junction Termination (7 Wire)", origin);
+        fldDevTerm = buffer.insertBlock(L"Field Device Termination (7 Wire)", fldDevOrigin);
+    } else {
+        junctionTerm = buffer.insertBlock(L"Junction Termination", origin);
+        fldDevTerm = buffer.insertBlock(L"Field Device Termination", fldDevOrigin);
+    }
+
+    // The blocks must be flipped if the whole cable is flipped
+    buffer.setProperty(junctionTerm, L"Flip state1", (short)(flip ? 1 : 0));
+    buffer.setProperty(fldDevTerm, L"Flip state1", (short)(flip ? 1 : 0));
+
+    buffer.setProperty(junctionTerm, L"Visibility1", visState);
+    buffer.setProperty(fldDevTerm, L"Visibility1", visState);
+
+    buffer.setLayer(junctionTerm, L"SKID WIRE DC");
+    buffer.setLayer(fldDevTerm, L"SKID WIRE DC");
+
+    buffer.setProperty(fldDevTerm, L"Distance1", 3.0);
+
+    // Cable lables
+    buffer.setAttribute(fldDevTerm, L"CL", getCableLabel(cable));
+
+    // Set FLDTAG attributes (different for 7 wire)
+    int numFldTags = getFieldTagCount(cable);
+
+    for (int i = 1; i <= numFldTags; ++i) {
+        int wireTerminal = getFieldTagTerminal(cable, terminalNumber, i);
+
+        std::wstring fldtag = junctionTag + L"-TB" + std::to_wstring(tableNumber) + L"(" + std::to_wstring(wireTerminal) + L")";
+        std::wstring tagName = L"FLDTAG" + std::to_wstring(i);
+
+        buffer.setAttribute(junctionTerm, tagName, fldtag);
+        buffer.setAttribute(fldDevTerm, tagName, fldtag);
+    }
+
+    // Draw every device
+    int numTerms = 0;
+    for (const Device& device : devices) {
+        drawDevice(buffer, device, { fldDevOrigin.x, fldDevOrigin.y - 0.25 * numTerms }, flip);
+
+        numTerms += device.getTerminalFootprint();
+    }
+
+    buffer.endGroup();
+}
+
+void drawDevice(DrawBuffer& buffer, const Device& device, LayoutPoint origin, bool flip) {
+    int footprint = device.getTerminalFootprint();
+    double direction = flip ? -1.0 : 1.0;
+
+    LayoutPoint termOrigin = { origin.x - 0.3438 * direction, origin.y + 0.125 };
+
+    static const double termOffset = -0.25;
+
+    std::uint32_t term1 = buffer.insertBlock(L"TBWIREMINI", termOrigin);
+    std::uint32_t term2 = buffer.insertBlock(L"TBWIREMINI", { termOrigin.x, termOrigin.y + termOffset });
+
+    // 2 pair devices label their first terminals L and N instead of + and -
+    buffer.setAttribute(term1, L"#", footprint == 6 ? L"L" : L"+");
+    buffer.setAttribute(term2, L"#", footprint == 6 ? L"N" : L"-");
+
+    buffer.setLayer(term1, L"ELECTRICAL - LIGHT");
+    buffer.setLayer(term2, L"ELECTRICAL - LIGHT");
+
+    buffer.setScale(term1, direction, 1.0, 1.0);
+    buffer.setScale(term2, direction, 1.0, 1.0);
+
+    LayoutPoint symbolOffset = { -0.9375 * direction, -0.125 };
+
+    if (footprint == 4) {
+        // TRIAD
+
+        std::uint32_t term3 = buffer.insertBlock(L"TBWIREMINI", { termOrigin.x, termOrigin.y + termOffset * 2 });
+
+        buffer.setAttribute(term3, L"#", L"REF");
+
+        buffer.setLayer(term3, L"ELECTRICAL - LIGHT");
+
+        buffer.setScale(term3, direction, 1.0, 1.0);
+
+        symbolOffset.y = -0.25;
+    }
+
+    if (footprint == 6) {
+        // 2 pair
+
+        std::uint32_t term3 = buffer.insertBlock(L"TBWIREMINI", { termOrigin.x, termOrigin.y + termOffset * 3 });
+        std::uint32_t term4 = buffer.insertBlock(L"TBWIREMINI", { termOrigin.x, termOrigin.y + termOffset * 4 });
+
+        buffer.setAttribute(term3, L"#", L"5");
+        buffer.setAttribute(term4, L"#", L"6");
+
+        buffer.setLayer(term3, L"ELECTRICAL - LIGHT");
+        buffer.setLayer(term4, L"ELECTRICAL - LIGHT");
+
+        buffer.setScale(term3, direction, 1.0, 1.0);
+        buffer.setScale(term4, direction, 1.0, 1.0);
+
+        symbolOffset.y = -0.5;
+    }
+
+    // Draw the symbol
+    std::uint32_t symbol = buffer.insertBlock(L"INST SYMBOL", { origin.x + symbolOffset.x, origin.y + symbolOffset.y });
+
+    std::string tag = device.getTag();
+    std::string number = device.getNumber();
+
+    buffer.setAttribute(symbol, L"TAG", std::wstring(tag.begin(), tag.end()));
+    buffer.setAttribute(symbol, L"NUMBER", std::wstring(number.begin(), number.end()));
+
+    buffer.setProperty(symbol, L"Flip state", (short)(flip ? 1 : 0));
+}
+
+void drawJunctionBox(DrawBuffer& buffer, const std::vector<Cable>& cables, const LayoutPlan& plan, const std::wstring& junctionTag) {
+    for (size_t i = 0; i < cables.size(); i++) {
+        const CablePlacement& placement = plan[i];
+
+        drawCable(buffer, cables[i], placement.origin, placement.terminal, placement.flip, junctionTag, placement.table);
+    }
+}
+
+std::wstring getCableLabel(const Cable& cable) {
+    std::string firstDevTag = cable.getDevices().at(0).getCombinedTag();
+    std::wstring firstDevTag_W(firstDevTag.begin(), firstDevTag.end());
+
+    size_t space = firstDevTag_W.find(L' ');
+    if (space != std::wstring::npos) firstDevTag_W.replace(space, 1, L"-");
+
+    return (cable.getIOType() == IOType::DIGITAL ? L"C-" : L"I-") + firstDevTag_W;
+}
+
+int getFieldTagCount(const Cable& cable) {
+    return getFieldTagCount(cable.getCableType());
+}
+
+int getFieldTagCount(CableType cableType) {
+    return cableType == CableType::WIRE7 ? 7 : 9;
+}
+
+int getFieldTagTerminal(const Cable& cable, int terminalNumber, int fieldTag) {
+    return getFieldTagTerminal(cable.getCableType(), terminalNumber, fieldTag);
+}
+
+int getFieldTagTerminal(CableType cableType, int terminalNumber, int fieldTag) {
+    int wireTerminal = terminalNumber + (fieldTag - 1);
+
+    // Deal with gaps
+    if (cableType == CableType::WIRE7) {
+        // There os a gap between tag 2 and 3, 4 and 5, and 6 and 7
+        if (fieldTag > 2) wireTerminal++;
+        if (fieldTag > 4) wireTerminal++;
+        if (fieldTag > 6) wireTerminal++;
+    } else {
+        // There is a gap between tag 5 and 6 as well as 7 and 8 
+        if (fieldTag > 5) wireTerminal++;
+        if (fieldTag > 7) wireTerminal++;
+    }
+
+    return wireTerminal;
+}
+
+const std::vector<std::wstring>& getDrawingBlockNames() {
+    static const std::vector<std::wstring> blockNames = {
+        L"Junction Termination",
+        L"Junction Termination (7 Wire)",
+        L"Field Device Termination",
+        L"Field Device Termination (7 Wire)",
+        L"TBWIREMINI",
+        L"INST SYMBOL"
+    };
+
+    return blockNames;
+}
+
+BlockKind getBlockKind(const std::wstring& blockName) {
+    if (blockName == L"Junction Termination") return BlockKind::JUNCTION_TERM;
+    if (blockName == L"Junction Termination (7 Wire)") return BlockKind::JUNCTION_TERM7;
+    if (blockName == L"Field Device Termination") return BlockKind::FIELD_DEV_TERM;
+    if (blockName == L"Field Device Termination (7 Wire)") return BlockKind::FIELD_DEV_TERM7;
+    if (blockName == L"TBWIREMINI") return BlockKind::TB_WIRE_MINI;
+    if (blockName == L"INST SYMBOL") return BlockKind::INST_SYMBOL;
+
+    return BlockKind::OTHER;
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static std::wstring _cableShape(const Cable& cable, bool flip) {
+    std::wstring shape = std::to_wstring(static_cast<int>(cable.getCableType()));
+    shape += flip ? L"|R|" : L"|L|";
+    shape += cable.getVisState();
+
+    for (const Device& device : cable.getDevices()) {
+        shape += L"|" + std::to_wstring(device.getTerminalFootprint());
+    }
+
+    return shape;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file DrawingScan.cpp
+ * @brief Definitions for reading the terminal table of an existing drawing.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "DrawingScan.h"
+
+#include "BlockKindCache.h"
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Read the tag and text of every attribute of a block in one pass.
+ *
+ * @param pBlockRef The block, open for read.
+ * @param block     Receives the attributes.
+ */
+static void _readAttributes(AcDbBlockReference* pBlockRef, ScanBlock& block);
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+Acad::ErrorStatus scanDrawing(const std::vector<AcDbObjectId>& objIds, TerminalTable& table) {
+    Acad::ErrorStatus es = acadStartTransaction();
+    if (es != Acad::eOk) return es;
+
+    BlockKindCache kindCache;
+    std::vector<ScanBlock> blocks;
+    blocks.reserve(objIds.size());
+
+    for (const AcDbObjectId& objId : objIds) {
+        AcDbBlockReference* pBlockRef = nullptr;
+        if (acadOpenObject(pBlockRef, objId, AcDb::kForRead) != Acad::eOk) continue; // not a block
+
+        ScanBlock block;
+        es = kindCache.getKind(pBlockRef, block.kind);
+        if (es != Acad::eOk) {
+            acutPrintf(L"\nError: Unable to get object block name.");
+            acadEndTransaction(false);
+            return es;
+        }
+
+        if (block.kind == BlockKind::OTHER) continue;
+
+        AcGePoint3d position = pBlockRef->position();
+        block.x = position.x;
+        block.y = position.y;
+        _readAttributes(pBlockRef, block);
+
+        // The visibility state shows which cable type a termination is drawn for
+        if (block.kind == BlockKind::JUNCTION_TERM || block.kind == BlockKind::JUNCTION_TERM7) {
+            AcDbEvalVariant visibility;
+            AcString value;
+            if (acadGetDynBlockProperty(pBlockRef, L"Visibility1", visibility) == Acad::eOk && visibility.getValue(value) == Acad::eOk) {
+                block.visibility = value.kwszPtr();
+            }
+        }
+
+        blocks.push_back(std::move(block));
+    }
+
+    // Nothing was changed
+    acadEndTransaction(false);
+
+    table = buildTerminalTable(blocks);
+
+    return Acad::eOk;
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static void _readAttributes(AcDbBlockReference* pBlockRef, ScanBlock& block) {
+    AcDbObjectIterator* pIter = pBlockRef->attributeIterator();
+    if (!pIter) return;
+
+    for (; !pIter->done(); pIter->step()) {
+        AcDbAttribute* pAtt = nullptr;
+        if (acadOpenObject(pAtt, pIter->objectId(), AcDb::kForRead) != Acad::eOk) continue;
+
+        block.attributes.emplace_back(pAtt->tag(), pAtt->textString());
+
+        acadCloseObject(pAtt);
+    }
+
+    delete pIter;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file DrawingSession.cpp
+ * @brief Definitions for the DrawingSession class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "DrawingSession.h"
+
+#include <utility>
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+DrawingSession::DrawingSession(BlockCache& cache, CablePrototypeCache& prototypes) :
+_cache(cache),
+_prototypes(prototypes)
+{
+    _pDb = acdbHostApplicationServices()->workingDatabase();
+    if (!_pDb) {
+        acutPrintf(L"\nError: No active database.");
+        return;
+    }
+
+    _begin();
+}
+
+DrawingSession::~DrawingSession() {
+    _end();
+}
+
+bool DrawingSession::isOpen() const {
+    return _pModelSpace != nullptr;
+}
+
+AcDbBlockReference* DrawingSession::insertBlock(const wchar_t* blockName, const AcGePoint3d& origin) {
+    if (!isOpen()) return nullptr;
+
+    const AcadBlockDefinition* pBlockDef = _cache.getBlock(_pDb, blockName);
+    if (!pBlockDef) return nullptr;
+
+    AcDbBlockReference* pBlockRef = nullptr;
+    acadInsertBlock(_pModelSpace, *pBlockDef, origin, pBlockRef);
+
+    return pBlockRef;
+}
+
+Acad::ErrorStatus DrawingSession::setLayer(AcDbEntity* pEnt, const wchar_t* layerName) {
+    if (!pEnt) return Acad::eNullObjectPointer;
+
+    AcDbObjectId layerId = _cache.getLayer(_pDb, layerName);
+    if (layerId.isNull()) return Acad::eKeyNotFound;
+
+    return pEnt->setLayer(layerId);
+}
+
+Acad::ErrorStatus DrawingSession::setDynBlockProperties(AcDbBlockReference* pBlkRef, const AcadDynPropertyList& values) {
+    return acadSetDynBlockProperties(pBlkRef, values, &_cache.getDynProperties());
+}
+
+const CablePrototype* DrawingSession::findPrototype(const std::wstring& shape) const {
+    return _prototypes.find(shape);
+}
+
+Acad::ErrorStatus DrawingSession::clonePrototype(const CablePrototype& prototype, const AcGePoint3d& origin, std::vector<AcDbBlockReference*>& outEntities) {
+    outEntities.clear();
+    if (!isOpen()) return Acad::eNullObjectPointer;
+
+    AcDbObjectIdArray ids;
+    for (const AcDbObjectId& id : prototype.entities) ids.append(id);
+
+    // Deep cloning copies the attributes and dynamic block state with each reference
+    AcDbIdMapping idMap;
+    Acad::ErrorStatus es = _pDb->deepCloneObjects(ids, _modelSpaceId, idMap);
+    if (es != Acad::eOk) {
+        acutPrintf(L"\nError: Could not copy cable prototype.");
+        return es;
+    }
+
+    AcGeMatrix3d xform = AcGeMatrix3d::translation(origin - prototype.origin);
+
+    for (const AcDbObjectId& id : prototype.entities) {
+        AcDbIdPair pair(id, AcDbObjectId::kNull, true);
+
+        AcDbBlockReference* pCopy = nullptr;
+        if (!idMap.compute(pair) || acadOpenObject(pCopy, pair.value(), AcDb::kForWrite) != Acad::eOk) {
+            pCopy = nullptr;
+        } else {
+            pCopy->transformBy(xform);
+        }
+
+        outEntities.push_back(pCopy);
+    }
+
+    return Acad::eOk;
+}
+
+void DrawingSession::addPrototype(const std::wstring& shape, CablePrototype prototype) {
+    // Its entities were opened through the transaction manager, so they can be
+    // cloned inside the same transaction and the box is committed once
+    _prototypes.add(shape, std::move(prototype));
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+void DrawingSession::_begin() {
+    if (acadStartTransaction() != Acad::eOk) return;
+    _open = true;
+
+    AcDbBlockTable* pBlockTable = nullptr;
+    if (acadOpenObject(pBlockTable, _pDb->blockTableId(), AcDb::kForRead) != Acad::eOk) {
+        acutPrintf(L"\nError: Could not access block table.");
+        return;
+    }
+
+    if (pBlockTable->getAt(ACDB_MODEL_SPACE, _modelSpaceId) != Acad::eOk ||
+        acadOpenObject(_pModelSpace, _modelSpaceId, AcDb::kForWrite) != Acad::eOk) {
+        acutPrintf(L"\nError: Could not open model space.");
+        _pModelSpace = nullptr;
+    }
+
+    acadCloseObject(pBlockTable);
+}
+
+void DrawingSession::_end() {
+    // Everything opened in the session is closed by ending the transaction
+    if (_open) acadEndTransaction(true);
+
+    _open = false;
+    _pModelSpace = nullptr;
+}
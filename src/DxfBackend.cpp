@@ -0,0 +1,482 @@
+/**
+ * @file DxfBackend.cpp
+ * @brief Definitions for the DxfBackend class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "DxfBackend.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+// -----------------------------------------------------------------------------
+// Internal Constants
+// -----------------------------------------------------------------------------
+
+static const char* const _applicationName = "JUNCTION_DYN"; ///< Extended data application of dynamic block properties.
+
+// -----------------------------------------------------------------------------
+// Internal Types
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Every command that applies to one block.
+ */
+struct _BlockState {
+    const DrawCommand* pInsert = nullptr;           ///< The INSERT_BLOCK command.
+    const DrawCommand* pLayer = nullptr;            ///< The last SET_LAYER command, or nullptr.
+    const DrawCommand* pScale = nullptr;            ///< The last SET_SCALE command, or nullptr.
+    std::vector<const DrawCommand*> properties;     ///< SET_PROPERTY commands in recorded order.
+    std::vector<const DrawCommand*> attributes;     ///< SET_ATTRIBUTE commands in recorded order.
+};
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Append a group code and its value.
+ */
+static void _group(std::string& text, int code, const char* value);
+
+/**
+ * @brief Append a group code and a drawing string.
+ */
+static void _group(std::string& text, int code, const std::wstring& value);
+
+/**
+ * @brief Append a group code and a real value, with six decimals.
+ */
+static void _group(std::string& text, int code, double value);
+
+/**
+ * @brief Append a group code and an integer value.
+ */
+static void _group(std::string& text, int code, int value);
+
+/**
+ * @brief Append an ATTRIB or ATTDEF placed by its definition.
+ *
+ * @param type       "ATTRIB" or "ATTDEF".
+ * @param layer      Layer of the entity.
+ * @param x          X of the insertion point of the block.
+ * @param y          Y of the insertion point of the block.
+ * @param scaleX     X scale of the block, negative if it is mirrored.
+ * @param scaleY     Y scale of the block.
+ * @param definition Where the block places the attribute.
+ * @param value      Text of the attribute.
+ */
+static void _attribute(std::string& text, const char* type, const std::wstring& layer, double x, double y, double scaleX, double scaleY, const DxfAttributeDefinition& definition, const std::wstring& value);
+
+/**
+ * @brief Read the next group code and value of a DXF file, without surrounding whitespace.
+ *
+ * @return false at the end of the file.
+ * @throws std::runtime_error if the file ends after a group code, or a group
+ *         code is not a number.
+ */
+static bool _readGroup(std::istream& in, int& code, std::string& value);
+
+/**
+ * @brief Append drawing text as the single byte text of the file.
+ *
+ * Drawing text is ASCII, anything else is written as '?'.
+ */
+static void _appendNarrow(std::string& text, const std::wstring& value);
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+DxfBlockTemplates readDxfBlockTemplates(std::istream& in) {
+    DxfBlockTemplates templates;
+
+    std::string section;
+    bool sectionName = false;
+
+    std::string entity;
+    std::wstring blockName;
+    double baseX = 0.0;
+    double baseY = 0.0;
+    std::vector<DxfAttributeDefinition> definitions;
+    DxfAttributeDefinition definition;
+
+    int code = 0;
+    std::string value;
+
+    while (_readGroup(in, code, value)) {
+        if (code == 0) {
+            // The previous entity ends here
+            if (entity == "ATTDEF" && !definition.tag.empty()) {
+                definition.x -= baseX;
+                definition.y -= baseY;
+                definition.alignX -= baseX;
+                definition.alignY -= baseY;
+                definitions.push_back(definition);
+            }
+
+            if (value == "ENDBLK" && !definitions.empty()) templates[blockName] = std::move(definitions);
+
+            if (value == "SECTION") sectionName = true;
+            if (value == "ENDSEC") section.clear();
+            if (value == "BLOCK") definitions.clear();
+
+            entity = (section == "BLOCKS") ? value : std::string();
+            definition = DxfAttributeDefinition();
+            continue;
+        }
+
+        if (sectionName && code == 2) {
+            section = value;
+            sectionName = false;
+            continue;
+        }
+
+        if (entity == "BLOCK") {
+            if (code == 2) blockName.assign(value.begin(), value.end());
+            if (code == 10) baseX = std::strtod(value.c_str(), nullptr);
+            if (code == 20) baseY = std::strtod(value.c_str(), nullptr);
+        } else if (entity == "ATTDEF") {
+            switch (code)
+            {
+            case 2 : definition.tag.assign(value.begin(), value.end()); break;
+            case 10 : definition.x = std::strtod(value.c_str(), nullptr); break;
+            case 20 : definition.y = std::strtod(value.c_str(), nullptr); break;
+            case 11 : definition.alignX = std::strtod(value.c_str(), nullptr); break;
+            case 21 : definition.alignY = std::strtod(value.c_str(), nullptr); break;
+            case 40 : definition.height = std::strtod(value.c_str(), nullptr); break;
+            case 50 : definition.rotation = std::strtod(value.c_str(), nullptr); break;
+            case 70 : definition.flags = std::atoi(value.c_str()); break;
+            case 72 : definition.horizontal = std::atoi(value.c_str()); break;
+            case 74 : definition.vertical = std::atoi(value.c_str()); break;
+            default: break;
+            }
+        }
+    }
+
+    return templates;
+}
+
+DxfBackend::DxfBackend(std::ostream& out, const std::vector<std::wstring>& blockNames, DxfBlockTemplates templates) :
+_out(out),
+_blocks(blockNames),
+_templates(std::move(templates))
+{
+    _begin();
+}
+
+DxfBackend::~DxfBackend() {
+    finish();
+}
+
+void DxfBackend::execute(const DrawBuffer& buffer) {
+    if (_finished) {
+        throw std::logic_error("DXF file was already finished");
+    }
+
+    const std::vector<DrawCommand>& commands = buffer.getCommands();
+
+    // Sort the commands by block in one pass, since the attributes of a block
+    // must directly follow its INSERT
+    std::vector<_BlockState> blocks(buffer.getBlockCount());
+
+    for (const DrawCommand& command : commands) {
+        switch (command.op)
+        {
+        case DrawOp::INSERT_BLOCK :
+            if (std::find(_blocks.begin(), _blocks.end(), buffer.getString(command.name)) == _blocks.end()) {
+                std::string name;
+                _appendNarrow(name, buffer.getString(command.name));
+                throw std::invalid_argument("Block " + name + " is not declared in the DXF block table");
+            }
+            blocks[command.block].pInsert = &command;
+            break;
+
+        case DrawOp::SET_ATTRIBUTE :
+            blocks[command.block].attributes.push_back(&command);
+            break;
+
+        case DrawOp::SET_PROPERTY :
+            blocks[command.block].properties.push_back(&command);
+            break;
+
+        case DrawOp::SET_LAYER :
+            blocks[command.block].pLayer = &command;
+            break;
+
+        case DrawOp::SET_SCALE :
+            blocks[command.block].pScale = &command;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    static const std::wstring defaultLayer = L"0";
+
+    std::vector<std::pair<const DrawCommand*, const DxfAttributeDefinition*>> placed;
+
+    for (const _BlockState& block : blocks) {
+        const DrawCommand& insert = *block.pInsert;
+        const std::wstring& layer = block.pLayer ? buffer.getString(block.pLayer->name) : defaultLayer;
+
+        // Only attributes whose definition is known can be placed
+        placed.clear();
+
+        auto found = _templates.find(buffer.getString(insert.name));
+        if (found != _templates.end()) {
+            for (const DrawCommand* pAttribute : block.attributes) {
+                const std::wstring& tag = buffer.getString(pAttribute->name);
+
+                for (const DxfAttributeDefinition& definition : found->second) {
+                    if (definition.tag != tag) continue;
+
+                    placed.emplace_back(pAttribute, &definition);
+                    break;
+                }
+            }
+        }
+
+        _group(_text, 0, "INSERT");
+        _group(_text, 8, layer);
+        if (!placed.empty()) _group(_text, 66, 1);
+        _group(_text, 2, buffer.getString(insert.name));
+        _group(_text, 10, insert.x);
+        _group(_text, 20, insert.y);
+        _group(_text, 30, 0.0);
+
+        if (block.pScale) {
+            _group(_text, 41, block.pScale->x);
+            _group(_text, 42, block.pScale->y);
+            _group(_text, 43, block.pScale->z);
+        }
+
+        if (!block.properties.empty()) {
+            _group(_text, 1001, _applicationName);
+
+            for (const DrawCommand* pProperty : block.properties) {
+                _group(_text, 1000, buffer.getString(pProperty->name));
+
+                switch (pProperty->valueType)
+                {
+                case DrawValueType::SHORT :
+                    _group(_text, 1070, static_cast<int>(pProperty->x));
+                    break;
+
+                case DrawValueType::DOUBLE :
+                    _group(_text, 1040, pProperty->x);
+                    break;
+
+                default:
+                    _group(_text, 1000, buffer.getString(pProperty->text));
+                    break;
+                }
+            }
+        }
+
+        if (placed.empty()) continue;
+
+        double scaleX = block.pScale ? block.pScale->x : 1.0;
+        double scaleY = block.pScale ? block.pScale->y : 1.0;
+
+        for (const auto& attribute : placed) {
+            _attribute(_text, "ATTRIB", layer, insert.x, insert.y, scaleX, scaleY, *attribute.second, buffer.getString(attribute.first->text));
+        }
+
+        _group(_text, 0, "SEQEND");
+        _group(_text, 8, layer);
+    }
+
+    // One write per box rather than one per group code
+    _out.write(_text.data(), _text.size());
+    _text.clear();
+}
+
+void DxfBackend::finish() {
+    if (_finished) return;
+
+    _group(_text, 0, "ENDSEC");
+    _group(_text, 0, "EOF");
+
+    _out.write(_text.data(), _text.size());
+    _out.flush();
+    _text.clear();
+
+    _finished = true;
+}
+
+void DxfBackend::_begin() {
+    _group(_text, 0, "SECTION");
+    _group(_text, 2, "HEADER");
+    _group(_text, 9, "$ACADVER");
+    _group(_text, 1, "AC1009");
+    _group(_text, 0, "ENDSEC");
+
+    // Extended data must name a registered application
+    _group(_text, 0, "SECTION");
+    _group(_text, 2, "TABLES");
+    _group(_text, 0, "TABLE");
+    _group(_text, 2, "APPID");
+    _group(_text, 70, 1);
+    _group(_text, 0, "APPID");
+    _group(_text, 2, _applicationName);
+    _group(_text, 70, 0);
+    _group(_text, 0, "ENDTAB");
+    _group(_text, 0, "ENDSEC");
+
+    _group(_text, 0, "SECTION");
+    _group(_text, 2, "BLOCKS");
+    static const std::wstring layer = L"0";
+
+    for (const std::wstring& name : _blocks) {
+        auto found = _templates.find(name);
+
+        _group(_text, 0, "BLOCK");
+        _group(_text, 8, "0");
+        _group(_text, 2, name);
+        _group(_text, 70, (found != _templates.end()) ? 2 : 0);
+        _group(_text, 10, 0.0);
+        _group(_text, 20, 0.0);
+        _group(_text, 30, 0.0);
+        _group(_text, 3, name);
+
+        if (found != _templates.end()) {
+            for (const DxfAttributeDefinition& definition : found->second) {
+                _attribute(_text, "ATTDEF", layer, 0.0, 0.0, 1.0, 1.0, definition, std::wstring());
+            }
+        }
+
+        _group(_text, 0, "ENDBLK");
+        _group(_text, 8, "0");
+    }
+    _group(_text, 0, "ENDSEC");
+
+    _group(_text, 0, "SECTION");
+    _group(_text, 2, "ENTITIES");
+
+    _out.write(_text.data(), _text.size());
+    _text.clear();
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static void _group(std::string& text, int code, const char* value) {
+    char digits[16];
+    text.append(digits, std::to_chars(digits, digits + sizeof(digits), code).ptr);
+    text += '\n';
+    text += value;
+    text += '\n';
+}
+
+static void _group(std::string& text, int code, const std::wstring& value) {
+    char digits[16];
+    text.append(digits, std::to_chars(digits, digits + sizeof(digits), code).ptr);
+    text += '\n';
+    _appendNarrow(text, value);
+    text += '\n';
+}
+
+static void _group(std::string& text, int code, double value) {
+    char digits[32];
+    text.append(digits, std::to_chars(digits, digits + sizeof(digits), code).ptr);
+    text += '\n';
+
+    // Drawing coordinates are small, so six fixed decimals fit in an integer.
+    // Coordinates that round to zero are written without a sign.
+    long long micros = std::llround(value * 1e6);
+    if (micros < 0) {
+        text += '-';
+        micros = -micros;
+    }
+
+    text.append(digits, std::to_chars(digits, digits + sizeof(digits), micros / 1000000).ptr);
+    text += '.';
+
+    char* end = std::to_chars(digits, digits + sizeof(digits), micros % 1000000 + 1000000).ptr;
+    text.append(digits + 1, end); // Skip the leading 1 that keeps the zeros
+    text += '\n';
+}
+
+static void _group(std::string& text, int code, int value) {
+    char digits[16];
+    text.append(digits, std::to_chars(digits, digits + sizeof(digits), code).ptr);
+    text += '\n';
+    text.append(digits, std::to_chars(digits, digits + sizeof(digits), value).ptr);
+    text += '\n';
+}
+
+static void _attribute(std::string& text, const char* type, const std::wstring& layer, double x, double y, double scaleX, double scaleY, const DxfAttributeDefinition& definition, const std::wstring& value) {
+    // Left and right swap in a mirrored block, so the text still reads left to right
+    int horizontal = definition.horizontal;
+    if (scaleX < 0.0 && horizontal == 0) horizontal = 2;
+    else if (scaleX < 0.0 && horizontal == 2) horizontal = 0;
+
+    // The point the text hangs from: the text point for left baseline text, the alignment point otherwise
+    bool textPoint = definition.horizontal == 0 && definition.vertical == 0;
+    double pointX = x + scaleX * (textPoint ? definition.x : definition.alignX);
+    double pointY = y + scaleY * (textPoint ? definition.y : definition.alignY);
+
+    _group(text, 0, type);
+    _group(text, 8, layer);
+    _group(text, 10, pointX);
+    _group(text, 20, pointY);
+    _group(text, 30, 0.0);
+    _group(text, 40, definition.height * std::abs(scaleY));
+    _group(text, 1, value);
+    if (definition.rotation != 0.0) _group(text, 50, definition.rotation);
+    if (std::strcmp(type, "ATTDEF") == 0) _group(text, 3, definition.tag); // prompt
+    _group(text, 2, definition.tag);
+    _group(text, 70, definition.flags);
+    if (horizontal != 0) _group(text, 72, horizontal);
+
+    if (horizontal != 0 || definition.vertical != 0) {
+        _group(text, 11, pointX);
+        _group(text, 21, pointY);
+        _group(text, 31, 0.0);
+    }
+
+    if (definition.vertical != 0) _group(text, 74, definition.vertical);
+}
+
+static bool _readGroup(std::istream& in, int& code, std::string& value) {
+    static const char* const whitespace = " \t\r";
+
+    std::string line;
+    if (!std::getline(in, line)) return false;
+
+    char* end = nullptr;
+    code = static_cast<int>(std::strtol(line.c_str(), &end, 10));
+    if (end == line.c_str() || line.find_first_not_of(whitespace, end - line.c_str()) != std::string::npos) {
+        throw std::runtime_error("Invalid DXF group code: " + line);
+    }
+
+    if (!std::getline(in, value)) {
+        throw std::runtime_error("DXF file ends after group code " + std::to_string(code));
+    }
+
+    size_t first = value.find_first_not_of(whitespace);
+    size_t last = value.find_last_not_of(whitespace);
+    value = (first == std::string::npos) ? std::string() : value.substr(first, last - first + 1);
+
+    return true;
+}
+
+static void _appendNarrow(std::string& text, const std::wstring& value) {
+    for (wchar_t c : value) text += (static_cast<unsigned long>(c) < 128) ? static_cast<char>(c) : '?';
+}
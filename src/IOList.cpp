@@ -0,0 +1,35 @@
+/**
+ * @file IOList.cpp
+ * @brief Definitions for the IOList class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "IOList.h"
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+void IOList::add(const std::string& combinedTag, IOListEntry entry) {
+    // emplace keeps the first row if the tag is listed twice
+    _entries.emplace(combinedTag, std::move(entry));
+}
+
+const IOListEntry* IOList::find(const std::string& combinedTag) const {
+    auto it = _entries.find(combinedTag);
+    if (it == _entries.end()) return nullptr;
+
+    return &it->second;
+}
+
+size_t IOList::size() const {
+    return _entries.size();
+}
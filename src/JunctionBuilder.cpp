@@ -18,17 +18,6 @@
 // Internal Types
 // -----------------------------------------------------------------------------
 
-/**
- * @enum BoxSize
- * @brief Predefined enclosure footprints supported by the tool.
- */
-enum BoxSize {
-    SMALL,  ///< 12" × 12" × 6" enclosure
-    MEDIUM, ///< 16" × 16" × 6" enclosure
-    LARGE,  ///< 24" × 24" × 8" enclosure
-    CUSTOM  ///< Custom enclosure. User will place the cables
-};
-
 /**
  * @struct DialogResult
  * @brief Aggregates the data collected from the user via the dialog box.
@@ -40,6 +29,28 @@ struct DialogResult {
     bool accepted = false;   ///< Set to true if the user pressed **OK**.
 };
 
+// -----------------------------------------------------------------------------
+// Internal State
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Parsed workbook shared by the dialog and the draw path for the
+ *        duration of a single BUILDJUNCTION command.
+ */
+static WorkbookCache _workbookCache;
+
+/**
+ * @brief Block definitions and layers used by every box drawn in a single
+ *        BUILDJUNCTION command.
+ */
+static BlockCache _blockCache;
+
+/**
+ * @brief Cables that later cables of the same shape are copied from, for the
+ *        duration of a single BUILDJUNCTION command.
+ */
+static CablePrototypeCache _prototypeCache;
+
 // -----------------------------------------------------------------------------
 // Forward Declarations
 // -----------------------------------------------------------------------------
@@ -52,26 +63,30 @@ struct DialogResult {
  *                      cables should be extracted.
  * @param selectedSize  Size of the box to be drawn.
  * @param origin        Point where the box should be drawn. (Usually 0 0 0)
+ * @param enclosure     Catalog enclosure to draw instead of `selectedSize`,
+ *                      or nullptr.
  */
-void _drawJunctionBox(std::string filename, std::string selectedTag, BoxSize selectedSize, AcGePoint3d origin);
+void _drawJunctionBox(std::string filename, std::string selectedTag, BoxSize selectedSize, AcGePoint3d origin, const Enclosure* enclosure = nullptr);
 
 /**
- * @brief Given a cable list and a current position in that list,
- *        should the next cable be drawn on the next table.
+ * @brief Ask for an enclosure from a catalog file to draw in place of a
+ *        custom box.
  *
- * @param boxSize               Size of the box.
- * @param cables                Reference to a vector of `Cable` objects.
- * @param currentCableIndex     The index of the cable that is about to be added to the drawing.
- * @param currentTerminalIndex  The terminal that the next cable will reside on.
- * @param currentTableIndex     The current table being drawn to.
- * @return                      `true` if the cable being drawn should be placed on the next table, `false` otherwise.
+ * The user picks a catalog file, or cancels for a plain custom box, and then
+ * names one of its enclosures on the command line.
+ *
+ * @param enclosure Receives the enclosure.
+ * @return          true if an enclosure was chosen, false otherwise.
  */
-bool _shouldSplit(BoxSize boxSize, std::vector<Cable> &cables, int currentCableIndex, int currentTerminalIndex, int currentTableIndex);
+bool _promptEnclosure(Enclosure& enclosure);
 
 /**
  * @brief Parse the provided Cable Schedule workbook and create a list of
  *        `Cable` objects for the specified junction tag.
  *
+ * The workbook is only parsed on the first request of a command; later
+ * requests are served from `_workbookCache`.
+ *
  * @param hDlg        Parent‑window handle used for any error message boxes.
  * @param filename    Absolute path to the Excel (.xlsx) file.
  * @param junctionTag Tag (e.g. "IJB-810") identifying the junction whose
@@ -88,6 +103,8 @@ std::vector<Cable> _xlsxGetCables(HWND hDlg,
  * @brief Collect all unique junction tags found in the Cable Schedule sheet of
  *        the workbook.
  *
+ * Parses the workbook into `_workbookCache` if it is not already cached.
+ *
  * @param hDlg     Parent‑window handle for error dialogs.
  * @param filename Path to the Excel workbook.
  * @param tags     Reference that will be filled with unique tags (output).
@@ -97,19 +114,17 @@ void _xlsxGetJunctionTags(HWND hDlg,
                            std::vector<std::string>& tags);
 
 /**
- * @brief Calculate the total number of terminals required by all cables that
- *        terminate in the given junction tag.
+ * @brief Evaluate how the cables that terminate in the given junction tag fit
+ *        in each standard box size.
  *
  * @param hDlg        Parent‑window handle for error dialogs.
  * @param filename    Path to the Excel workbook.
- * @param junctionTag Junction tag whose footprint is required.
- * @param boxSize     Size of the box to calculate the footprint on. (Required to account for table splitting)
- * @return            Terminal count ("footprint").
+ * @param junctionTag Junction tag whose fit is required.
+ * @return            One fit for each standard box size, indexed by `BoxSize`.
  */
-int _xlsxGetJunctionFootprint(HWND hDlg,
-                              std::string filename,
-                              std::string junctionTag,
-                              BoxSize boxSize);
+std::vector<BoxFit> _xlsxGetBoxFits(HWND hDlg,
+                                    const std::string& filename,
+                                    const std::string& junctionTag);
 
 /**
  * brief Update the size‑selection radio buttons to show how many spare
@@ -161,6 +176,53 @@ INT_PTR CALLBACK _DialogProc(HWND hDlg,
                              WPARAM wParam,
                              LPARAM lParam);
 
+/**
+ * @brief Build the selection filter for the blocks of cables.
+ *
+ * Admits INSERTs of the blocks a cable is drawn with and of anonymous blocks,
+ * which dynamic block references with modified properties point to. Lines,
+ * text and title block geometry are rejected by AutoCAD before any of them is
+ * opened.
+ *
+ * @param modelSpace true to also reject entities outside model space.
+ * @return           The filter, to be released with `acutRelRb`.
+ */
+resbuf* _cableBlockFilter(bool modelSpace);
+
+/**
+ * @brief Get the blocks of cables the user selected.
+ *
+ * Uses the implied selection if there is one, otherwise asks the user to
+ * select objects. Either way the selection is filtered with
+ * `_cableBlockFilter`.
+ *
+ * @param objIds Receives the selected block references.
+ * @return       false if the user canceled, true otherwise.
+ */
+bool _selectCableBlocks(std::vector<AcDbObjectId>& objIds);
+
+/**
+ * @brief Get the blocks of every cable in model space.
+ *
+ * @param objIds Receives the block references.
+ */
+void _findCableBlocks(std::vector<AcDbObjectId>& objIds);
+
+/**
+ * @brief Get the object id of every entity in a selection set.
+ *
+ * @param ss     The selection set, freed by this function.
+ * @param objIds Receives the object ids.
+ */
+void _getSelectionIds(ads_name ss, std::vector<AcDbObjectId>& objIds);
+
+/**
+ * @brief Quote drawing text for a CSV field if it needs it.
+ *
+ * Drawing text is ASCII, anything else is written as '?'.
+ */
+std::string _csvField(const std::wstring& text);
+
 
 // -----------------------------------------------------------------------------
 // Function Definitions
@@ -192,12 +254,21 @@ void buildJunctionBox() {
                     adsw_acadMainWnd(), _DialogProc, reinterpret_cast<LPARAM>(&result));
 
     if (!result.accepted) {
+        _workbookCache.clear();
         acutPrintf(L"\nCanceled.");
         return;
     }
 
+    // A custom box can be drawn as one of the enclosures of a catalog instead
+    Enclosure enclosure;
+    const Enclosure* selectedEnclosure = nullptr;
+    if (result.selectedSize == BoxSize::CUSTOM && _promptEnclosure(enclosure)) {
+        selectedEnclosure = &enclosure;
+    }
+
     if (result.selectedTag == "Select All") {
-        // Draw every single box
+        // Draw every single box. The workbook is partitioned by junction when it is
+        // first parsed, so each box is a lookup rather than another pass over the sheet.
 
         std::vector<std::string> junctionTags;
 
@@ -206,223 +277,312 @@ void buildJunctionBox() {
         for (int i = 0; i < junctionTags.size(); ++i) {
             std::string tag = junctionTags[i];
 
-            _drawJunctionBox(result.filename, tag, result.selectedSize, AcGePoint3d(-11.0 * i, 0.0, 0.0));
+            _drawJunctionBox(result.filename, tag, result.selectedSize, AcGePoint3d(-11.0 * i, 0.0, 0.0), selectedEnclosure);
         }
     } else {
-        _drawJunctionBox(result.filename, result.selectedTag, result.selectedSize, AcGePoint3d(0.0, 0.0, 0.0));
+        _drawJunctionBox(result.filename, result.selectedTag, result.selectedSize, AcGePoint3d(0.0, 0.0, 0.0), selectedEnclosure);
     }
+
+    _prototypeCache.clear();
+    _blockCache.clear();
+    _workbookCache.clear();
 }
 
 void flipCable() {
-    ads_name ss;
+    std::vector<AcDbObjectId> objIds;
+    if (!_selectCableBlocks(objIds)) return;
+
+    // Any block of a recorded cable flips the whole cable
+    CableRecordStore records;
+    if (records.load(acdbHostApplicationServices()->workingDatabase()) == Acad::eOk) {
+        records.expandToCables(objIds);
+    }
 
-    int result = acedSSGet(L"I", nullptr, nullptr, nullptr, ss);
+    // Every block is opened once and each cable is mirrored about its junction termination
+    int cableCount = 0;
+    if (flipCables(objIds, cableCount) != Acad::eOk) {
+        acutPrintf(L"\nError: Unable to flip the selected cables.");
+    }
+}
 
-    if (result != RTNORM) {
-        // No implied selection — ask user to select objects manually
-        acutPrintf(L"\nPlease select objects:");
-        result = acedSSGet(nullptr, nullptr, nullptr, nullptr, ss);
+void reIndexCable() {
+    std::vector<AcDbObjectId> objIds;
+    if (!_selectCableBlocks(objIds)) return;
 
-        if (result != RTNORM) {
-            acutPrintf(L"\nCanceled.");
-            return;
-        }
+    // Any block of a recorded cable re-indexes the whole cable
+    CableRecordStore records;
+    if (records.load(acdbHostApplicationServices()->workingDatabase()) == Acad::eOk) {
+        records.expandToCables(objIds);
     }
 
-    int length = 0;
-    acedSSLength(ss, &length);
-    
-    for (int i = 0; i < length; ++i) {
-        ads_name ent;
-        acedSSName(ss, i, ent);
+    int startingTerminal = 0;
+    acedGetInt(L"What terminal number do you want to start from?", startingTerminal);
 
-        AcDbObjectId objId;
-        acdbGetObjectId(objId, ent);
+    // Terminations are indexed by height once, then each block's tags are written in one pass
+    int cableCount = 0;
+    if (reindexCables(objIds, startingTerminal, cableCount, &records) != Acad::eOk) {
+        acutPrintf(L"\nError: Unable to re-index the selected cables.");
+    } else if (cableCount == 0) {
+        acutPrintf(L"\nNo junction termination selected.");
+    }
+}
 
-        std::wstring blockName;
-        Acad::ErrorStatus es = acadGetBlockName(objId, blockName);
-        if (es != Acad::eOk) {
-            acutPrintf(L"\nError: Unable to get object block name.");
-            return;
-        }
+void reIndexAll() {
+    std::vector<AcDbObjectId> objIds;
+    _findCableBlocks(objIds);
 
-        AcGePoint3d position;
-        acadGetObjectPosition(objId, position);
-        
-        if (blockName == L"Junction Termination" || blockName == L"Junction Termination (7 Wire)") {
-            AcDbEvalVariant flipVariant;
-            acadGetDynBlockProperty(objId, L"Flip state1", flipVariant);
+    CableRecordStore records;
+    records.load(acdbHostApplicationServices()->workingDatabase());
 
-            int flipValue;
-            flipVariant.getValue(flipValue);
+    // Every table is found and renumbered from one read of model space
+    int tableCount = 0;
+    int cableCount = 0;
+    if (reindexAllCables(objIds, tableCount, cableCount, &records) != Acad::eOk) {
+        acutPrintf(L"\nError: Unable to re-index the drawing.");
+        return;
+    }
 
-            acadSetDynBlockProperty(objId, L"Flip state1", AcDbEvalVariant((short)(flipValue == 0 ? 1 : 0)));
-        } else if (blockName == L"Field Device Termination" || blockName == L"Field Device Termination (7 Wire)") {
-            AcDbEvalVariant flipVariant;
-            acadGetDynBlockProperty(objId, L"Flip state1", flipVariant);
+    acutPrintf(L"\nRe-indexed %d cables on %d terminal tables.", cableCount, tableCount);
+}
 
-            int flipValue;
-            flipVariant.getValue(flipValue);
+void autoReindex() {
+    AcDbDatabase* pDb = acdbHostApplicationServices()->workingDatabase();
 
-            if (flipValue == 1) {
-                // Pointing right, move left
-                position.x -= 18.0;
-            } else {
-                position.x += 18.0;
-            }
+    if (isCableMoveWatcherRunning(pDb)) {
+        stopCableMoveWatcher();
+        acutPrintf(L"\nMoved cables will no longer be re-indexed.");
+        return;
+    }
 
-            acadSetObjectPosition(objId, position);
-            acadSetDynBlockProperty(objId, L"Flip state1", AcDbEvalVariant((short)(flipValue == 0 ? 1 : 0)));
-        } else if (blockName == L"TBWIREMINI") {
-            AcGeScale3d scaleValue;
-            acadGetObjectScale(objId, scaleValue);
+    if (startCableMoveWatcher(pDb) != Acad::eOk) {
+        acutPrintf(L"\nError: Unable to watch the drawing for moved cables.");
+        return;
+    }
 
-            if (scaleValue[0] == -1.0) {
-                position.x -= 18.6876;
-            } else {
-                position.x += 18.6876;
-            }
+    acutPrintf(L"\nCables moved to another terminal will be re-indexed when each command ends.");
+}
 
-            acadSetObjectPosition(objId, position);
-            acadSetObjectScale(objId, AcGeScale3d(-scaleValue[0], 1.0, 1.0));
-        } else if (blockName == L"INST SYMBOL") {
-            AcDbEvalVariant flipVariant;
-            acadGetDynBlockProperty(objId, L"Flip state", flipVariant);
+void exportTerminals() {
+    std::vector<AcDbObjectId> objIds;
+    _findCableBlocks(objIds);
 
-            int flipValue;
-            flipVariant.getValue(flipValue);
+    TerminalTable table;
+    if (scanDrawing(objIds, table) != Acad::eOk) {
+        acutPrintf(L"\nError: Unable to read the cables of the drawing.");
+        return;
+    }
 
-            if (flipValue == 1) {
-                // Pointing right, move left
-                position.x -= 19.8751;
-            } else {
-                position.x += 19.8751;
-            }
+    char fileName[MAX_PATH] = "terminals.csv";
+    OPENFILENAME ofn = { sizeof(ofn) };
+    ofn.lpstrFilter = "CSV Files\0*.csv\0";
+    ofn.lpstrFile = fileName;
+    ofn.nMaxFile = MAX_PATH;
+    ofn.lpstrDefExt = "csv";
+    ofn.Flags = OFN_OVERWRITEPROMPT | OFN_PATHMUSTEXIST;
+    ofn.hwndOwner = adsw_acadMainWnd();
 
-            acadSetObjectPosition(objId, position);
-            acadSetDynBlockProperty(objId, L"Flip state", AcDbEvalVariant((short)(flipValue == 0 ? 1 : 0)));
-        }
+    if (!GetSaveFileName(&ofn)) {
+        acutPrintf(L"\nCanceled.");
+        return;
     }
 
-    acedSSFree(ss);
+    // One write for the whole table
+    std::string text = "Junction,Table,Terminal,Cable,Device,Wire\n";
+    for (const TerminalRow& row : table.rows) {
+        text += _csvField(row.junctionTag) + "," + std::to_string(row.table) + "," + std::to_string(row.terminal) + ","
+              + _csvField(row.cableLabel) + "," + _csvField(row.deviceTag) + "," + _csvField(row.wire) + "\n";
+    }
+
+    std::ofstream out(fileName, std::ios::binary);
+    out.write(text.data(), text.size());
+    if (!out) {
+        acutPrintf(L"\nError: Unable to write the terminal table.");
+        return;
+    }
+
+    acutPrintf(L"\nExported %d terminals of %d cables.", static_cast<int>(table.rows.size()), static_cast<int>(table.cables.size()));
+
+    if (table.unnumberedCount > 0) {
+        acutPrintf(L"\nWarning: %d junction terminations have no terminal number.", static_cast<int>(table.unnumberedCount));
+    }
+
+    if (table.unmatchedCount > 0) {
+        acutPrintf(L"\nWarning: %d blocks are not drawn next to a junction termination.", static_cast<int>(table.unmatchedCount));
+    }
 }
 
-void reIndexCable() {
-    ads_name ss;
+void verifyDrawing() {
+    char fileName[MAX_PATH] = {};
+    OPENFILENAME ofn = { sizeof(ofn) };
+    ofn.lpstrFilter = "Excel Files\0*.xlsx\0";
+    ofn.lpstrFile = fileName;
+    ofn.nMaxFile = MAX_PATH;
+    ofn.Flags = OFN_FILEMUSTEXIST | OFN_PATHMUSTEXIST;
+    ofn.hwndOwner = adsw_acadMainWnd();
 
-    int result = acedSSGet(L"I", nullptr, nullptr, nullptr, ss);
+    if (!GetOpenFileName(&ofn)) {
+        acutPrintf(L"\nCanceled.");
+        return;
+    }
 
-    if (result != RTNORM) {
-        // No implied selection — ask user to select objects manually
-        acutPrintf(L"\nPlease select objects:");
-        result = acedSSGet(nullptr, nullptr, nullptr, nullptr, ss);
+    std::vector<AcDbObjectId> objIds;
+    _findCableBlocks(objIds);
 
-        if (result != RTNORM) {
-            acutPrintf(L"\nCanceled.");
-            return;
-        }
+    TerminalTable table;
+    if (scanDrawing(objIds, table) != Acad::eOk) {
+        acutPrintf(L"\nError: Unable to read the cables of the drawing.");
+        return;
     }
 
-    int startingTerminal = 0;
-    acedGetInt(L"What terminal number do you want to start from?", startingTerminal);
+    std::vector<CableMismatch> mismatches;
+    try {
+        mismatches = verifyTerminalTable(*_workbookCache.get(fileName), table);
+    } catch (const std::exception& e) {
+        MessageBox(adsw_acadMainWnd(), e.what(), "Error", MB_OK | MB_ICONERROR);
+        _workbookCache.clear();
+        return;
+    }
 
-    int length = 0;
-    acedSSLength(ss, &length);
+    _workbookCache.clear();
 
-    // Determine which junction box is the highest so we can index from there
-    double highest = std::numeric_limits<double>::lowest();
-    for (int i = 0; i < length; ++i) {
-        ads_name ent;
-        acedSSName(ss, i, ent);
+    std::set<std::wstring> junctionTags;
+    for (const DrawnCable& cable : table.cables) junctionTags.insert(cable.junctionTag);
 
-        AcDbObjectId objId;
-        acdbGetObjectId(objId, ent);
+    // Only the stale cables are listed
+    for (const CableMismatch& mismatch : mismatches) {
+        const CableSignature& expected = mismatch.expected;
+        const CableSignature& drawn = mismatch.drawn;
 
-        std::wstring blockName;
-        if (acadGetBlockName(objId, blockName) != Acad::eOk)
-            continue; // skip if we can't resolve name
+        switch (mismatch.kind)
+        {
+        case MismatchKind::MISSING :
+            acutPrintf(L"\n%ls %ls: in the workbook but not drawn, expected on TB%d(%d).",
+                       expected.junctionTag.c_str(), expected.cableLabel.c_str(), expected.table, expected.firstTerminal);
+            break;
 
-        if (blockName != L"Junction Termination" &&
-            blockName != L"Junction Termination (7 Wire)")
-            continue; // not a termination
+        case MismatchKind::EXTRA :
+            acutPrintf(L"\n%ls %ls: drawn on TB%d(%d) but not in the workbook.",
+                       drawn.junctionTag.c_str(), drawn.cableLabel.c_str(), drawn.table, drawn.firstTerminal);
+            break;
+
+        default:
+            if (expected.table != drawn.table || expected.firstTerminal != drawn.firstTerminal) {
+                acutPrintf(L"\n%ls %ls: drawn on TB%d(%d), expected on TB%d(%d).",
+                           drawn.junctionTag.c_str(), drawn.cableLabel.c_str(), drawn.table, drawn.firstTerminal, expected.table, expected.firstTerminal);
+            } else {
+                acutPrintf(L"\n%ls %ls: cable type or devices on TB%d(%d) differ from the workbook.",
+                           drawn.junctionTag.c_str(), drawn.cableLabel.c_str(), drawn.table, drawn.firstTerminal);
+            }
+            break;
+        }
+    }
+
+    acutPrintf(L"\nChecked %d cables in %d junction boxes: %d do not match the workbook.",
+               static_cast<int>(table.cables.size()), static_cast<int>(junctionTags.size()), static_cast<int>(mismatches.size()));
+}
+
+void openCounts() {
+    AcadOpenCounter counter = acadGetOpenCounter();
+    acadResetOpenCounter();
 
-        AcGePoint3d position;
-        if (acadGetObjectPosition(objId, position) != Acad::eOk)
-            continue; // skip unsupported entities
+    acutPrintf(L"\nOpened %ld objects and closed %ld since the counts were last shown.", counter.opens, counter.closes);
 
-        if (position.y > highest)
-            highest = position.y;
+    if (counter.opens != counter.closes) {
+        acutPrintf(L"\nWarning: %ld objects are still open.", counter.opens - counter.closes);
     }
+}
 
-    // Re-index
-    for (int i = 0; i < length; ++i) { 
-        ads_name ent;
-        acedSSName(ss, i, ent);
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
 
-        AcDbObjectId objId;
-        acdbGetObjectId(objId, ent);
+resbuf* _cableBlockFilter(bool modelSpace) {
+    // Block names are a comma separated wildcard list, and the backquote keeps
+    // the * of anonymous block names literal
+    std::wstring blockNames = L"`*U*";
+    for (const std::wstring& blockName : getDrawingBlockNames()) {
+        blockNames += L",";
+        blockNames += blockName;
+    }
 
-        std::wstring blockName;
-        if (acadGetBlockName(objId, blockName) != Acad::eOk)
-            continue; // skip if we can't resolve name
+    if (modelSpace) {
+        return acutBuildList(RTDXF0, L"INSERT", 2, blockNames.c_str(), 410, L"Model", RTNONE);
+    }
 
-        AcGePoint3d position;
-        if (acadGetObjectPosition(objId, position) != Acad::eOk)
-            continue; // skip unsupported entities
+    return acutBuildList(RTDXF0, L"INSERT", 2, blockNames.c_str(), RTNONE);
+}
 
-        double heightDif = highest - position.y;
-        int terminalDif = std::round(heightDif / 0.25);
+bool _selectCableBlocks(std::vector<AcDbObjectId>& objIds) {
+    resbuf* pFilter = _cableBlockFilter(false);
 
-        if (blockName == L"Junction Termination" || blockName == L"Field Device Termination") {
-            for (int j = 1; j <= 9; ++j) {
-                wchar_t tagName[32];
-                swprintf(tagName, L"FLDTAG%d", j);
+    ads_name ss;
 
-                std::wstring fldtag;
-                acadGetBlockAttribute(objId, tagName, fldtag);
+    int result = acedSSGet(L"I", nullptr, nullptr, pFilter, ss);
 
-                int currentTerminal = terminalDif + j + startingTerminal - 1;
-                
-                if (j > 5) currentTerminal ++;
-                if (j > 7) currentTerminal ++;
+    if (result != RTNORM) {
+        // No implied selection — ask user to select objects manually
+        acutPrintf(L"\nPlease select objects:");
+        result = acedSSGet(nullptr, nullptr, nullptr, pFilter, ss);
+    }
 
-                wchar_t termText[32];
-                swprintf(termText, L"(%d)", currentTerminal);
+    acutRelRb(pFilter);
 
-                fldtag.replace(fldtag.find('('), std::wstring::npos, termText);
+    if (result != RTNORM) {
+        acutPrintf(L"\nCanceled.");
+        return false;
+    }
 
-                acadSetBlockAttribute(objId, tagName, fldtag.c_str());
-            }
-        } else if (blockName == L"Junction Termination (7 Wire)" || blockName == L"Field Device Termination (7 Wire)") {
-            for (int j = 1; j <= 7; ++j) {
-                wchar_t tagName[32];
-                swprintf(tagName, L"FLDTAG%d", j);
+    _getSelectionIds(ss, objIds);
 
-                std::wstring fldtag;
-                acadGetBlockAttribute(objId, tagName, fldtag);
+    return true;
+}
 
-                int currentTerminal = terminalDif + j + startingTerminal - 1;
-                
-                if (j > 2) currentTerminal ++;
-                if (j > 4) currentTerminal ++;
-                if (j > 6) currentTerminal ++;
+void _findCableBlocks(std::vector<AcDbObjectId>& objIds) {
+    resbuf* pFilter = _cableBlockFilter(true);
 
-                wchar_t termText[32];
-                swprintf(termText, L"(%d)", currentTerminal);
+    ads_name ss;
+    int result = acedSSGet(L"X", nullptr, nullptr, pFilter, ss);
 
-                fldtag.replace(fldtag.find('('), std::wstring::npos, termText);
+    acutRelRb(pFilter);
 
-                acadSetBlockAttribute(objId, tagName, fldtag.c_str());
-            }
-        }
+    if (result == RTNORM) _getSelectionIds(ss, objIds);
+}
+
+void _getSelectionIds(ads_name ss, std::vector<AcDbObjectId>& objIds) {
+    int length = 0;
+    acedSSLength(ss, &length);
+
+    objIds.reserve(length);
+
+    for (int i = 0; i < length; ++i) {
+        ads_name ent;
+        acedSSName(ss, i, ent);
+
+        AcDbObjectId objId;
+        acdbGetObjectId(objId, ent);
+
+        objIds.push_back(objId);
     }
+
+    acedSSFree(ss);
 }
 
-// -----------------------------------------------------------------------------
-// Helper Function Definitions
-// -----------------------------------------------------------------------------
+std::string _csvField(const std::wstring& text) {
+    std::string field;
+    for (wchar_t c : text) field += (static_cast<unsigned long>(c) < 128) ? static_cast<char>(c) : '?';
 
-void _drawJunctionBox(std::string filename, std::string selectedTag, BoxSize selectedSize, AcGePoint3d origin) {
+    if (field.find_first_of(",\"\n") == std::string::npos) return field;
+
+    std::string quoted = "\"";
+    for (char c : field) {
+        if (c == '"') quoted += '"';
+        quoted += c;
+    }
+
+    return quoted + "\"";
+}
+
+void _drawJunctionBox(std::string filename, std::string selectedTag, BoxSize selectedSize, AcGePoint3d origin, const Enclosure* enclosure) {
     // Go through the .xlsx and build a cable object for every cable listed in the file.
     std::vector<Cable> cables = _xlsxGetCables(adsw_acadMainWnd(), filename, selectedTag);
 
@@ -446,44 +606,23 @@ void _drawJunctionBox(std::string filename, std::string selectedTag, BoxSize sel
 
     std::wstring junctionTag(selectedTag.begin(), selectedTag.end());
 
-    switch (selectedSize)
-    {
-    case BoxSize::LARGE :
-        origin.set(11.1875, 18.3250, 0.0);
-        break;
-
-    case BoxSize::MEDIUM :
-        origin.set(19.3750, 14.7500, 0.0);
-        break;
+    LayoutPlan plan = enclosure ? LayoutPlanner(*enclosure).plan(cables) : LayoutPlanner(selectedSize, { origin.x, origin.y }).plan(cables);
 
-    case BoxSize::SMALL :
-        origin.set(19.3750, 12.4977, 0.0);
-        break;
-    
-    default:
-        break;
+    if (enclosure && plan.overflows()) {
+        acutPrintf(L"\nWarning: The cables of %hs do not fit in %hs, the extra cables run off the table.", selectedTag.c_str(), enclosure->name.c_str());
     }
 
-    int terminal = 1;
-    int table = 1;
-    for (int i = 0; i < cables.size(); i++) {
+    DrawBuffer buffer;
+    drawJunctionBox(buffer, cables, plan, junctionTag);
 
-        if (_shouldSplit(selectedSize, cables, i, terminal, table)) {
-            terminal = 1;
-            table ++;
-        }
-
-        bool flip = false;
-        AcGePoint3d drawPoint = origin + AcGeVector3d(0.0, -0.25, 0.0) * (terminal - 1);
-        if (selectedSize == BoxSize::LARGE && table == 2) {
-            flip = true;
-            drawPoint += AcGeVector3d(10.625, 0.0, 0.0);
-        }
+    ArxDrawBackend backend(_blockCache, _prototypeCache);
+    backend.execute(buffer);
 
-        cables[i].draw(drawPoint, terminal, flip, junctionTag.c_str(), table);
-
-        terminal += cables[i].getTerminalFootprint();
-    }
+    // Keep what each cable is with the drawing, so the edit commands do not
+    // have to work it out from the blocks again
+    CableRecordStore::addCables(acdbHostApplicationServices()->workingDatabase(),
+                                getCableRecords(cables, plan, junctionTag),
+                                backend.getGroupEntities());
 
     /*
         Customer side cables are out of the scope of this tool. If customer side cables are
@@ -491,109 +630,71 @@ void _drawJunctionBox(std::string filename, std::string selectedTag, BoxSize sel
     */
 }
 
-bool _shouldSplit(BoxSize boxSize, std::vector<Cable> &cables, int currentCableIndex, int currentTerminalIndex, int currentTableIndex) {
-    if (boxSize == BoxSize::LARGE) {
-        // If the rest of the cables take more space than in table 2, dont split
-        int sizeOfRest = 0;
-        for (int j = currentCableIndex; j < cables.size(); j++) {
-            sizeOfRest += cables[j].getTerminalFootprint();
-        }
-
-        if (sizeOfRest <= 72 && currentCableIndex != 0 && currentTableIndex == 1) {
-
-            // If the current cable is a safety cable, but the previous cable is control, split
-            if (cables[currentCableIndex].getSystemType() == SystemType::SAFETY && cables[currentCableIndex - 1].getSystemType() == SystemType::CONTROL) {
-                return true;
-            }
-
-            // If we've reached the end of the table, split
-            if (currentTerminalIndex + cables[currentCableIndex].getTerminalFootprint() - 1 > 72) {
-                return true;
-            }       
-        }
-
-    }
-
-
-    return false;
-}
+bool _promptEnclosure(Enclosure& enclosure) {
+    char fileName[MAX_PATH] = {};
+    OPENFILENAME ofn = { sizeof(ofn) };
+    ofn.lpstrTitle = "Enclosure Catalog (Cancel for a Custom Box)";
+    ofn.lpstrFilter = "Enclosure Catalogs\0*.txt\0All Files\0*.*\0";
+    ofn.lpstrFile = fileName;
+    ofn.nMaxFile = MAX_PATH;
+    ofn.Flags = OFN_FILEMUSTEXIST | OFN_PATHMUSTEXIST;
+    ofn.hwndOwner = adsw_acadMainWnd();
 
-std::vector<Cable> _xlsxGetCables(HWND hDlg, const std::string& filename, const std::string& junctionTag) {
-    std::vector<Cable> cables;
+    if (!GetOpenFileName(&ofn)) return false;
 
-    OpenXLSX::XLDocument doc;
+    BoxCatalog catalog;
     try {
-        doc.open(filename);
+        catalog = BoxCatalog::open(fileName);
     } catch (const std::exception& e) {
-        doc.close();
-        return cables;
+        MessageBox(adsw_acadMainWnd(), e.what(), "Error", MB_OK | MB_ICONERROR);
+        return false;
     }
 
-    OpenXLSX::XLWorksheet cableWks;
-    OpenXLSX::XLWorksheet ioWks;
-    try {
-        cableWks = doc.workbook().worksheet("Cable Schedule Data");
-        ioWks = doc.workbook().worksheet("IO List");
+    const std::vector<Enclosure>& enclosures = catalog.getEnclosures();
+    if (enclosures.empty()) {
+        acutPrintf(L"\nThe catalog has no enclosures, drawing a custom box.");
+        return false;
+    }
 
+    acutPrintf(L"\nEnclosures:");
+    for (const Enclosure& listed : enclosures) {
+        acutPrintf(L"\n  %hs (%d tables, %d terminals)", listed.name.c_str(), static_cast<int>(listed.tables.size()), listed.getCapacity());
+    }
 
-        for (int row = 3; cableWks.cell(row, 4).value() != ""; ++row) {
-            if (cableWks.cell(row, 3).value() != junctionTag) continue;
+    std::wstring prompt = L"\nEnclosure name <" + std::wstring(enclosures[0].name.begin(), enclosures[0].name.end()) + L">: ";
+    ACHAR name[256] = {};
+    if (acedGetString(1, prompt.c_str(), name, 256) != RTNORM) return false;
 
-            std::string combinedTag = cableWks.cell(row, 4).value();
-            std::string instrumentSpec;
-            
-            CableType wireType;
-            SystemType systemType;
-            IOType ioType;
-
-            // Go find the respective info in IO List
-            bool found = false;
-            for (int row = 7; ioWks.cell(row, 2).value() != ""; ++row) {
-                if (ioWks.cell(row, 2).value() == combinedTag) {
-                    systemType = Cable::getSystemTypeFromCell(ioWks.cell(row, 8).value());
-                    ioType = Cable::getIOTypeFromCell(ioWks.cell(row, 7).value());
-                    instrumentSpec = ioWks.cell(row, 5).value().getString();
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                throw std::runtime_error("Device in Cable Schedule Data does not exist in IO List");
-            }
-            
-            if (cableWks.cell(row, 1).value().typeAsString() == "string") {
-                // We are on a new cable
-                std::string qty = cableWks.cell(row, 1).value();
+    std::wstring wideName(name);
+    if (wideName.empty()) {
+        enclosure = enclosures[0];
+        return true;
+    }
 
-                wireType = Cable::getWireTypeFromCell(qty);
+    std::string narrowName;
+    for (wchar_t c : wideName) narrowName += static_cast<char>(c);
 
-                cables.push_back(Cable(
-                    wireType,
-                    systemType,
-                    ioType
-                ));
-            }
+    const Enclosure* found = catalog.find(narrowName);
+    if (!found) {
+        acutPrintf(L"\nEnclosure %ls is not in the catalog, drawing a custom box.", name);
+        return false;
+    }
 
-            // Add the current device to the cable
-            int deviceFootprint = Device::footprintFromCells(combinedTag, instrumentSpec);
-            Device device(combinedTag, deviceFootprint);
+    enclosure = *found;
+    return true;
+}
 
-            if (!cables.empty()) {
-                cables.back().addDevice(device);
-            }
-        }
+std::vector<Cable> _xlsxGetCables(HWND hDlg, const std::string& filename, const std::string& junctionTag) {
+    std::vector<Cable> cables;
 
+    try {
+        std::shared_ptr<const Workbook> workbook = _workbookCache.get(filename);
+        cables = workbook->getCables(junctionTag);
     } catch (const std::exception& e) {
-        std::string message = "Excel file is not compatible: ";
-        message += e.what();
-        MessageBox(hDlg, message.c_str(), "Error", MB_OK | MB_ICONERROR);
-        doc.close();
+        MessageBox(hDlg, e.what(), "Error", MB_OK | MB_ICONERROR);
         cables.clear();
-        return cables;
     }
 
-    doc.close();
-
     return cables;
 }
 
@@ -601,67 +702,22 @@ void _xlsxGetJunctionTags(HWND hDlg, const std::string& filename, std::vector<st
     // Empty tags
     tags.clear();
 
-    OpenXLSX::XLDocument doc;
-    try {
-        doc.open(filename);
-    } catch (const std::exception& e) {
-        std::string message = "Failed to open Excel file: ";
-        message += e.what();
-        MessageBox(hDlg, message.c_str(), "Error", MB_OK | MB_ICONERROR);
-        doc.close();
-        return;
-    }
-
-    // Open the Cable Schedule Data worksheet
-    OpenXLSX::XLWorksheet wks;
     try {
-        wks = doc.workbook().worksheet("Cable Schedule Data");
-
-        for (int row = 3; wks.cell(row, 4).value() != ""; ++row) {
-            std::string junctionTag = wks.cell(row, 3).value();
-
-            if (junctionTag == "N/A") continue;
-
-            if (std::find(tags.begin(), tags.end(), junctionTag) == tags.end()) {
-                tags.push_back(junctionTag);
-            }
-        }
+        std::shared_ptr<const Workbook> workbook = _workbookCache.get(filename);
+        tags = workbook->getJunctionTags();
     } catch (const std::exception& e) {
-        std::string message = "Excel file is not compatible: ";
-        message += e.what();
-        MessageBox(hDlg, message.c_str(), "Error", MB_OK | MB_ICONERROR);
-        doc.close();
-        return;
+        MessageBox(hDlg, e.what(), "Error", MB_OK | MB_ICONERROR);
     }
-
-    doc.close();
 }
 
-int _xlsxGetJunctionFootprint(HWND hDlg, std::string filename, std::string junctionTag, BoxSize boxSize) {
+std::vector<BoxFit> _xlsxGetBoxFits(HWND hDlg, const std::string& filename, const std::string& junctionTag) {
     std::vector<Cable> cables = _xlsxGetCables(hDlg, filename, junctionTag);
 
-    int footprint = 0;
-    int terminal = 1;
-    int table = 1;
-
-    for (int i = 0; i < cables.size(); ++i) {
-        if (_shouldSplit(boxSize, cables, i, terminal, table)) {
-            terminal = 1;
-            table ++;
-        }
-
-        terminal += cables[i].getTerminalFootprint();
-        footprint += cables[i].getTerminalFootprint();
-
-        // Check if we over ran any tables, and return the largest int possible to indicate the box is full
-        if (boxSize == BoxSize::LARGE && terminal > 72) return std::numeric_limits<int>::max();
-    }
-
-    return footprint;
+    return FitEvaluator::evaluate(cables);
 }
 
 void _updateSizeRadioButtons(HWND hDlg, const std::vector<HWND>& sizeButtons, const std::vector<int>& spareCounts) {
-    const std::vector<std::string> boxSizes = { "24x24x8", "16x16x6", "12x12x6", "Custom Box" };
+    const std::vector<std::string> boxSizes = { LARGE_BOX.name, MEDIUM_BOX.name, SMALL_BOX.name, "Custom Box" };
 
     for (size_t i = 0; i < sizeButtons.size(); ++i) {
         std::string displayText;
@@ -760,7 +816,7 @@ void _rebuildDialogBox(const std::vector<std::string>& junctionTags, std::vector
     }
 
     // --- Static Box Size Group ---
-    const std::vector<std::string> boxSizes = { "24x24x8", "16x16x6", "12x12x6", "Custom Box" };
+    const std::vector<std::string> boxSizes = { LARGE_BOX.name, MEDIUM_BOX.name, SMALL_BOX.name, "Custom Box" };
 
     int sizesGroupBoxY = tagsGroupBoxY + tagsGroupBoxHeight + 10;
     int sizesGroupBoxHeight = static_cast<int>(boxSizes.size()) * radioSpacing + 2 * groupBoxPadding;
@@ -837,16 +893,17 @@ INT_PTR CALLBACK _DialogProc(HWND hDlg, UINT message, WPARAM wParam, LPARAM lPar
         // If one of the junction tag radio buttons is selected
         if (ctrlId >= IDC_RADIO_TAG_GROUP + 1 && ctrlId < IDC_RADIO_TAG_GROUP + 2 + junctionTags.size()) {
             int selectedIndex = ctrlId - IDC_RADIO_TAG_GROUP - 1;
-            std::string selectedTag = junctionTags[selectedIndex];
 
             if (selectedIndex == junctionTags.size()) {
                 spareCounts[0] = -1;
                 spareCounts[1] = -1;
                 spareCounts[2] = -1;
             } else {
-                spareCounts[0] = 144 - _xlsxGetJunctionFootprint(hDlg, filenameString, selectedTag, BoxSize::LARGE);
-                spareCounts[1] = 42  - _xlsxGetJunctionFootprint(hDlg, filenameString, selectedTag, BoxSize::MEDIUM);;
-                spareCounts[2] = 24  - _xlsxGetJunctionFootprint(hDlg, filenameString, selectedTag, BoxSize::SMALL);;
+                std::vector<BoxFit> fits = _xlsxGetBoxFits(hDlg, filenameString, junctionTags[selectedIndex]);
+
+                spareCounts[0] = fits[BoxSize::LARGE].spare;
+                spareCounts[1] = fits[BoxSize::MEDIUM].spare;
+                spareCounts[2] = fits[BoxSize::SMALL].spare;
             }
 
             spareCounts[3] = 0;
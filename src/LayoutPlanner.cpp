@@ -0,0 +1,364 @@
+/**
+ * @file LayoutPlanner.cpp
+ * @brief Definitions for the LayoutPlan, LayoutPlanner and FitEvaluator classes.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "LayoutPlanner.h"
+
+#include <algorithm>
+#include <array>
+#include <limits> // for std::numeric_limits
+#include <stdexcept>
+#include <utility>
+
+// -----------------------------------------------------------------------------
+// Internal Constants
+// -----------------------------------------------------------------------------
+
+static const double _terminalPitch = 0.25; ///< Vertical distance between two terminals.
+
+// -----------------------------------------------------------------------------
+// Internal Types
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Number of tables of a `Tables` type known at compile time, or 0 if it
+ *        is only known at run time.
+ */
+template <typename Tables>
+struct _StaticTableCount {
+    static constexpr size_t value = 0;
+};
+
+template <size_t N>
+struct _StaticTableCount<std::array<TableSpec, N>> {
+    static constexpr size_t value = N;
+};
+
+/**
+ * @brief For each table, the total capacity of every table after it.
+ */
+template <size_t N>
+static std::array<int, N> _capacitiesAfter(const std::array<TableSpec, N>& tables) {
+    std::array<int, N> after{};
+    int sum = 0;
+    for (size_t t = N; t-- > 0;) {
+        after[t] = sum;
+        sum += tables[t].capacity;
+    }
+    return after;
+}
+
+static std::vector<int> _capacitiesAfter(const std::vector<TableSpec>& tables) {
+    std::vector<int> after(tables.size());
+    int sum = 0;
+    for (size_t t = tables.size(); t-- > 0;) {
+        after[t] = sum;
+        sum += tables[t].capacity;
+    }
+    return after;
+}
+
+/**
+ * @brief Tracks the current table and terminal while cables are placed in a box.
+ *
+ * This holds the table split rules shared by `LayoutPlanner` and `FitEvaluator`.
+ * For single table boxes known at compile time the split check is compiled out.
+ */
+template <typename Tables>
+struct _TableCursor {
+    const Tables& tables;   ///< Tables of the box.
+    decltype(_capacitiesAfter(std::declval<const Tables&>())) capacitiesAfter; ///< Capacity of the tables after each table.
+    size_t table = 0;       ///< Index of the current table.
+    int terminal = 1;       ///< Next free terminal of the current table.
+    int overflowIndex = -1; ///< First cable that ran off its table, or -1.
+
+    _TableCursor(const Tables& tables) :
+    tables(tables),
+    capacitiesAfter(_capacitiesAfter(tables))
+    {}
+
+    /**
+     * @brief Place the next cable.
+     *
+     * @param cableIndex   Index of the cable being placed.
+     * @param footprint    Terminals needed by the cable.
+     * @param remaining    Terminals needed by the cable and every cable after it.
+     * @param safetyStarts true if this is a safety cable following a control cable.
+     * @return             The first terminal of the cable, on table `table`.
+     */
+    int place(size_t cableIndex, int footprint, int remaining, bool safetyStarts) {
+        if constexpr (_StaticTableCount<Tables>::value != 1) {
+            // Move on once the rest of the cables fit on the following tables and
+            // either the safety cables start or this table is full
+            if (table + 1 < tables.size() && cableIndex != 0 && remaining <= capacitiesAfter[table]) {
+                if (safetyStarts || terminal + footprint - 1 > tables[table].capacity) {
+                    table ++;
+                    terminal = 1;
+                }
+            }
+        }
+
+        int first = terminal;
+        terminal += footprint;
+
+        if (terminal - 1 > tables[table].capacity && overflowIndex < 0) {
+            overflowIndex = static_cast<int>(cableIndex);
+        }
+
+        return first;
+    }
+};
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Get the terminal footprint of every cable.
+ *
+ * @param cables The cables.
+ * @param total  Receives the sum of every footprint (output).
+ * @return       Footprints in cable order.
+ */
+static std::vector<int> _footprints(const std::vector<Cable>& cables, int& total);
+
+/**
+ * @brief Is cable `index` a safety cable that follows a control cable.
+ */
+static bool _safetyStarts(const std::vector<Cable>& cables, size_t index);
+
+/**
+ * @brief Create an empty fit for a box.
+ */
+template <typename Tables>
+static BoxFit _emptyFit(BoxSize boxSize, const std::string& name, const Tables& tables);
+
+/**
+ * @brief Fill in the totals of a fit once every cable is placed.
+ */
+static void _finishFit(BoxFit& fit, int footprint, int overflowIndex);
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+const std::vector<CablePlacement>& LayoutPlan::getPlacements() const {
+    return _placements;
+}
+
+int LayoutPlan::getFootprint() const {
+    return _footprint;
+}
+
+bool LayoutPlan::overflows() const {
+    return _overflowIndex >= 0;
+}
+
+int LayoutPlan::getOverflowIndex() const {
+    return _overflowIndex;
+}
+
+size_t LayoutPlan::size() const {
+    return _placements.size();
+}
+
+const CablePlacement& LayoutPlan::operator[](size_t index) const {
+    return _placements.at(index);
+}
+
+LayoutPlanner::LayoutPlanner(BoxSize boxSize, LayoutPoint origin) :
+_boxSize(boxSize)
+{
+    // A custom box is a single table with no terminal limit
+    if (_boxSize == BoxSize::CUSTOM) {
+        _tables.push_back({ std::numeric_limits<int>::max(), origin.x, origin.y, false });
+    }
+}
+
+LayoutPlanner::LayoutPlanner(const Enclosure& enclosure) :
+_boxSize(BoxSize::CUSTOM),
+_tables(enclosure.tables)
+{
+    if (_tables.empty()) {
+        throw std::invalid_argument("Enclosure " + enclosure.name + " has no terminal tables");
+    }
+}
+
+LayoutPlan LayoutPlanner::plan(const std::vector<Cable>& cables) const {
+    switch (_boxSize)
+    {
+    case BoxSize::SMALL :
+        return _plan(SMALL_BOX.tables, cables);
+
+    case BoxSize::MEDIUM :
+        return _plan(MEDIUM_BOX.tables, cables);
+
+    case BoxSize::LARGE :
+        return _plan(LARGE_BOX.tables, cables);
+
+    default:
+        return _plan(_tables, cables);
+    }
+}
+
+template <typename Tables>
+LayoutPlan LayoutPlanner::_plan(const Tables& tables, const std::vector<Cable>& cables) {
+    LayoutPlan plan;
+    plan._placements.reserve(cables.size());
+
+    // The footprint of each cable is needed several times, so work it out once
+    std::vector<int> footprints = _footprints(cables, plan._footprint);
+
+    _TableCursor<Tables> cursor(tables);
+
+    int placed = 0; // Terminals used by every cable before the current one
+    for (size_t i = 0; i < cables.size(); ++i) {
+        int terminal = cursor.place(i, footprints[i], plan._footprint - placed, _safetyStarts(cables, i));
+
+        const TableSpec& table = tables[cursor.table];
+
+        CablePlacement placement;
+        placement.table = static_cast<int>(cursor.table) + 1;
+        placement.terminal = terminal;
+        placement.flip = table.flip;
+        placement.origin = { table.originX, table.originY - _terminalPitch * (terminal - 1) };
+
+        plan._placements.push_back(placement);
+
+        placed += footprints[i];
+    }
+
+    plan._overflowIndex = cursor.overflowIndex;
+
+    return plan;
+}
+
+std::vector<BoxFit> FitEvaluator::evaluate(const std::vector<Cable>& cables) {
+    std::vector<BoxFit> fits;
+    fits.push_back(_emptyFit(BoxSize::SMALL, SMALL_BOX.name, SMALL_BOX.tables));
+    fits.push_back(_emptyFit(BoxSize::MEDIUM, MEDIUM_BOX.name, MEDIUM_BOX.tables));
+    fits.push_back(_emptyFit(BoxSize::LARGE, LARGE_BOX.name, LARGE_BOX.tables));
+
+    int total = 0;
+    std::vector<int> footprints = _footprints(cables, total);
+
+    _TableCursor<decltype(SMALL_BOX.tables)> small(SMALL_BOX.tables);
+    _TableCursor<decltype(MEDIUM_BOX.tables)> medium(MEDIUM_BOX.tables);
+    _TableCursor<decltype(LARGE_BOX.tables)> large(LARGE_BOX.tables);
+
+    int placed = 0; // Terminals used by every cable before the current one
+    for (size_t i = 0; i < cables.size(); ++i) {
+        int footprint = footprints[i];
+        bool safetyStarts = _safetyStarts(cables, i);
+
+        small.place(i, footprint, total - placed, safetyStarts);
+        medium.place(i, footprint, total - placed, safetyStarts);
+        large.place(i, footprint, total - placed, safetyStarts);
+
+        fits[BoxSize::SMALL].tableFill[small.table] += footprint;
+        fits[BoxSize::MEDIUM].tableFill[medium.table] += footprint;
+        fits[BoxSize::LARGE].tableFill[large.table] += footprint;
+
+        placed += footprint;
+    }
+
+    _finishFit(fits[BoxSize::SMALL], total, small.overflowIndex);
+    _finishFit(fits[BoxSize::MEDIUM], total, medium.overflowIndex);
+    _finishFit(fits[BoxSize::LARGE], total, large.overflowIndex);
+
+    return fits;
+}
+
+std::vector<BoxFit> FitEvaluator::evaluate(const std::vector<Cable>& cables, const std::vector<Enclosure>& enclosures) {
+    std::vector<BoxFit> fits;
+    std::vector<_TableCursor<std::vector<TableSpec>>> cursors;
+    fits.reserve(enclosures.size());
+    cursors.reserve(enclosures.size());
+
+    for (const Enclosure& enclosure : enclosures) {
+        fits.push_back(_emptyFit(BoxSize::CUSTOM, enclosure.name, enclosure.tables));
+        cursors.emplace_back(enclosure.tables);
+    }
+
+    int total = 0;
+    std::vector<int> footprints = _footprints(cables, total);
+
+    int placed = 0; // Terminals used by every cable before the current one
+    for (size_t i = 0; i < cables.size(); ++i) {
+        int footprint = footprints[i];
+        bool safetyStarts = _safetyStarts(cables, i);
+
+        for (size_t e = 0; e < cursors.size(); ++e) {
+            if (cursors[e].tables.empty()) continue;
+
+            cursors[e].place(i, footprint, total - placed, safetyStarts);
+            fits[e].tableFill[cursors[e].table] += footprint;
+        }
+
+        placed += footprint;
+    }
+
+    for (size_t e = 0; e < fits.size(); ++e) {
+        // An enclosure without tables cannot hold any cable
+        int overflowIndex = cursors[e].overflowIndex;
+        if (cursors[e].tables.empty() && !cables.empty()) overflowIndex = 0;
+
+        _finishFit(fits[e], total, overflowIndex);
+    }
+
+    return fits;
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static std::vector<int> _footprints(const std::vector<Cable>& cables, int& total) {
+    std::vector<int> footprints;
+    footprints.reserve(cables.size());
+
+    total = 0;
+    for (const Cable& cable : cables) {
+        footprints.push_back(cable.getTerminalFootprint());
+        total += footprints.back();
+    }
+
+    return footprints;
+}
+
+static bool _safetyStarts(const std::vector<Cable>& cables, size_t index) {
+    return index != 0 &&
+           cables[index].getSystemType() == SystemType::SAFETY &&
+           cables[index - 1].getSystemType() == SystemType::CONTROL;
+}
+
+template <typename Tables>
+static BoxFit _emptyFit(BoxSize boxSize, const std::string& name, const Tables& tables) {
+    BoxFit fit;
+    fit.boxSize = boxSize;
+    fit.name = name;
+    fit.capacity = 0;
+    for (const TableSpec& table : tables) fit.capacity += table.capacity;
+    fit.footprint = 0;
+    fit.spare = 0;
+    fit.tableFill.assign(tables.size(), 0);
+    fit.overflowIndex = -1;
+    return fit;
+}
+
+static void _finishFit(BoxFit& fit, int footprint, int overflowIndex) {
+    fit.footprint = footprint;
+    fit.overflowIndex = overflowIndex;
+    fit.spare = fit.capacity - footprint;
+    if (overflowIndex >= 0) fit.spare = std::min(fit.spare, -1);
+}
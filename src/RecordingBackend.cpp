@@ -0,0 +1,117 @@
+/**
+ * @file RecordingBackend.cpp
+ * @brief Definitions for the RecordingBackend class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "RecordingBackend.h"
+
+#include <cstdio>
+#include <string>
+
+// -----------------------------------------------------------------------------
+// Internal Constants
+// -----------------------------------------------------------------------------
+
+static const char* const _opNames[] = { "INSERT", "ATTRIB", "PROP", "LAYER", "SCALE", "BEGIN", "END" };
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Convert a recorded string to text for the transcript.
+ *
+ * Drawing text is ASCII, anything else is written as '?'.
+ */
+static std::string _narrow(const std::wstring& text);
+
+/**
+ * @brief Format a number with four decimals, without a negative zero.
+ */
+static std::string _number(double value);
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+RecordingBackend::RecordingBackend(std::ostream& out) :
+_pOut(&out)
+{}
+
+void RecordingBackend::execute(const DrawBuffer& buffer) {
+    for (const DrawCommand& command : buffer.getCommands()) {
+        _counts[static_cast<size_t>(command.op)]++;
+
+        if (!_pOut) continue;
+
+        std::ostream& out = *_pOut;
+        out << _opNames[static_cast<size_t>(command.op)];
+
+        switch (command.op)
+        {
+        case DrawOp::INSERT_BLOCK :
+        case DrawOp::BEGIN_GROUP :
+            out << ' ' << command.block << " \"" << _narrow(buffer.getString(command.name)) << "\" "
+                << _number(command.x) << ' ' << _number(command.y);
+            break;
+
+        case DrawOp::SET_ATTRIBUTE :
+            out << ' ' << command.block << ' ' << _narrow(buffer.getString(command.name))
+                << " \"" << _narrow(buffer.getString(command.text)) << '"';
+            break;
+
+        case DrawOp::SET_PROPERTY :
+            out << ' ' << command.block << " \"" << _narrow(buffer.getString(command.name)) << "\" ";
+            if (command.valueType == DrawValueType::STRING) {
+                out << '"' << _narrow(buffer.getString(command.text)) << '"';
+            } else {
+                out << _number(command.x);
+            }
+            break;
+
+        case DrawOp::SET_LAYER :
+            out << ' ' << command.block << " \"" << _narrow(buffer.getString(command.name)) << '"';
+            break;
+
+        case DrawOp::SET_SCALE :
+            out << ' ' << command.block << ' ' << _number(command.x) << ' ' << _number(command.y) << ' ' << _number(command.z);
+            break;
+
+        case DrawOp::END_GROUP :
+            break;
+        }
+
+        out << '\n';
+    }
+}
+
+std::size_t RecordingBackend::getCount(DrawOp op) const {
+    return _counts[static_cast<size_t>(op)];
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static std::string _narrow(const std::wstring& text) {
+    std::string narrow;
+    narrow.reserve(text.size());
+    for (wchar_t c : text) narrow += (static_cast<unsigned long>(c) < 128) ? static_cast<char>(c) : '?';
+    return narrow;
+}
+
+static std::string _number(double value) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.4f", value);
+    if (std::string(buffer) == "-0.0000") return "0.0000";
+    return buffer;
+}
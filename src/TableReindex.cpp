@@ -0,0 +1,347 @@
+/**
+ * @file TableReindex.cpp
+ * @brief Definitions for renumbering every terminal table of a drawing.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "TableReindex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cwchar>
+#include <map>
+#include <utility>
+
+// -----------------------------------------------------------------------------
+// Internal Constants
+// -----------------------------------------------------------------------------
+
+static const double _terminalPitch = 0.25;      ///< Vertical distance between two terminals.
+static const double _columnGap = 0.5;           ///< Horizontal distance that separates two tables of the same prefix.
+static const double _fieldDeviceOffset = 9.0;   ///< Horizontal distance of a field device termination from its junction termination.
+static const double _tolerance = 1e-6;          ///< Slack for comparing drawing coordinates.
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Get the field tag text before the terminal number.
+ *
+ * @return true if a field tag has a terminal number, false otherwise.
+ */
+static bool _fieldTagPrefix(const ReindexBlock& block, std::wstring& prefix);
+
+/**
+ * @brief Get the cable type whose wire gaps a termination is drawn with.
+ *
+ * @return true if the block is a junction termination.
+ */
+static bool _terminationType(BlockKind kind, bool& junction, CableType& cableType);
+
+/**
+ * @brief Find the table a field device termination belongs to.
+ *
+ * @param x      X coordinate of the field device termination.
+ * @param tables The tables of its prefix.
+ * @return       The table, or nullptr if none is 9 units away.
+ */
+static const ReindexTable* _findTable(double x, const std::vector<const ReindexTable*>& tables);
+
+/**
+ * @brief Append an update for every field tag of a block whose terminal changes.
+ */
+static void _renumber(const ReindexBlock& block, size_t index, CableType cableType, int firstTerminal, std::vector<FieldTagUpdate>& updates);
+
+/**
+ * @brief Find the field device termination of a junction termination from the drawing.
+ *
+ * @param blocks            Every termination of the drawing.
+ * @param junction          Index of the junction termination.
+ * @param fieldDevicesByTag The field device terminations by FLDTAG1.
+ * @return                  Index of the field device termination about 9 units to
+ *                          either side with the same FLDTAG1, closest in height, or
+ *                          UNRECORDED_BLOCK if there is none.
+ */
+static size_t _findFieldDevice(const std::vector<ReindexBlock>& blocks, size_t junction, const std::map<std::wstring, std::vector<size_t>>& fieldDevicesByTag);
+
+/**
+ * @brief Get the terminal of a block's FLDTAG1.
+ *
+ * @return false if FLDTAG1 has no terminal number.
+ */
+static bool _firstTerminal(const ReindexBlock& block, int& terminal);
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+ReindexResult reindexTables(const std::vector<ReindexBlock>& blocks) {
+    ReindexResult result;
+
+    // Group the junction terminations by prefix, in a stable order
+    std::map<std::wstring, std::vector<size_t>> junctions;
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        bool junction = false;
+        CableType cableType = CableType::PAIR1;
+        if (!_terminationType(blocks[i].kind, junction, cableType) || !junction) continue;
+
+        std::wstring prefix;
+        if (!_fieldTagPrefix(blocks[i], prefix)) continue;
+
+        junctions[prefix].push_back(i);
+    }
+
+    // Split each prefix into columns from left to right
+    for (auto& entry : junctions) {
+        std::vector<size_t>& indices = entry.second;
+        std::stable_sort(indices.begin(), indices.end(), [&](size_t a, size_t b) {
+            return blocks[a].x < blocks[b].x;
+        });
+
+        size_t start = 0;
+        for (size_t i = 1; i <= indices.size(); ++i) {
+            if (i < indices.size() && blocks[indices[i]].x - blocks[indices[i - 1]].x <= _columnGap) continue;
+
+            ReindexTable table;
+            table.prefix = entry.first;
+            table.left = blocks[indices[start]].x;
+            table.right = blocks[indices[i - 1]].x;
+            table.terminations.assign(indices.begin() + start, indices.begin() + i);
+
+            std::stable_sort(table.terminations.begin(), table.terminations.end(), [&](size_t a, size_t b) {
+                return blocks[a].y > blocks[b].y;
+            });
+            table.top = blocks[table.terminations.front()].y;
+
+            result.tables.push_back(std::move(table));
+            start = i;
+        }
+    }
+
+    std::map<std::wstring, std::vector<const ReindexTable*>> tablesByPrefix;
+    for (const ReindexTable& table : result.tables) {
+        tablesByPrefix[table.prefix].push_back(&table);
+    }
+
+    // Number every termination in input order, so the updates come out by block
+    result.firstTerminals.assign(blocks.size(), 0);
+
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        const ReindexBlock& block = blocks[i];
+
+        bool junction = false;
+        CableType cableType = CableType::PAIR1;
+        if (!_terminationType(block.kind, junction, cableType)) continue;
+
+        std::wstring prefix;
+        if (!_fieldTagPrefix(block, prefix)) continue;
+
+        auto it = tablesByPrefix.find(prefix);
+        const ReindexTable* pTable = nullptr;
+
+        if (junction) {
+            // Every junction termination with a prefix is in exactly one column
+            for (const ReindexTable* pCandidate : it->second) {
+                if (block.x >= pCandidate->left - _tolerance && block.x <= pCandidate->right + _tolerance) {
+                    pTable = pCandidate;
+                    break;
+                }
+            }
+            result.cableCount++;
+        } else if (it != tablesByPrefix.end()) {
+            pTable = _findTable(block.x, it->second);
+        }
+
+        if (!pTable) {
+            result.unmatchedCount++;
+            continue;
+        }
+
+        int firstTerminal = 1 + static_cast<int>(std::round((pTable->top - block.y) / _terminalPitch));
+        result.firstTerminals[i] = firstTerminal;
+        _renumber(block, i, cableType, firstTerminal, result.updates);
+    }
+
+    return result;
+}
+
+ReindexResult reindexMoved(const std::vector<ReindexBlock>& blocks, const std::vector<bool>& moved, const std::vector<size_t>& fieldDevices) {
+    ReindexResult result;
+    result.firstTerminals.assign(blocks.size(), 0);
+
+    // The junction terminations that stayed in place by prefix, and every
+    // field device termination by its FLDTAG1
+    std::map<std::wstring, std::vector<size_t>> references;
+    std::map<std::wstring, std::vector<size_t>> fieldDevicesByTag;
+
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        bool junction = false;
+        CableType cableType = CableType::PAIR1;
+        if (!_terminationType(blocks[i].kind, junction, cableType)) continue;
+
+        int terminal = 0;
+        std::wstring prefix;
+        if (!_firstTerminal(blocks[i], terminal) || !_fieldTagPrefix(blocks[i], prefix)) continue;
+
+        if (!junction) {
+            fieldDevicesByTag[blocks[i].fieldTags[0]].push_back(i);
+        } else if (!moved[i]) {
+            references[prefix].push_back(i);
+        }
+    }
+
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        if (!moved[i]) continue;
+
+        const ReindexBlock& block = blocks[i];
+
+        bool junction = false;
+        CableType cableType = CableType::PAIR1;
+        if (!_terminationType(block.kind, junction, cableType) || !junction) continue;
+
+        int terminal = 0;
+        std::wstring prefix;
+        if (!_firstTerminal(block, terminal) || !_fieldTagPrefix(block, prefix)) continue;
+
+        auto it = references.find(prefix);
+        if (it == references.end()) continue;
+
+        // The closest unmoved termination of its column
+        const ReindexBlock* pReference = nullptr;
+        for (size_t r : it->second) {
+            const ReindexBlock& candidate = blocks[r];
+            if (std::abs(candidate.x - block.x) > _columnGap) continue;
+
+            if (!pReference || std::abs(candidate.y - block.y) < std::abs(pReference->y - block.y)) pReference = &candidate;
+        }
+
+        if (!pReference) continue; // moved with its table
+
+        int referenceTerminal = 0;
+        _firstTerminal(*pReference, referenceTerminal);
+
+        int firstTerminal = referenceTerminal + static_cast<int>(std::round((pReference->y - block.y) / _terminalPitch));
+        if (firstTerminal == terminal) continue;
+
+        result.firstTerminals[i] = firstTerminal;
+        _renumber(block, i, cableType, firstTerminal, result.updates);
+        result.cableCount++;
+
+        size_t fieldDevice = (i < fieldDevices.size()) ? fieldDevices[i] : UNRECORDED_BLOCK;
+        if (fieldDevice == UNRECORDED_BLOCK) fieldDevice = _findFieldDevice(blocks, i, fieldDevicesByTag);
+        if (fieldDevice == UNRECORDED_BLOCK || result.firstTerminals[fieldDevice] != 0) continue;
+
+        bool fieldJunction = false;
+        CableType fieldType = CableType::PAIR1;
+        if (!_terminationType(blocks[fieldDevice].kind, fieldJunction, fieldType) || fieldJunction) continue;
+
+        result.firstTerminals[fieldDevice] = firstTerminal;
+        _renumber(blocks[fieldDevice], fieldDevice, fieldType, firstTerminal, result.updates);
+    }
+
+    // Field device terminations come out with their junction terminations
+    std::stable_sort(result.updates.begin(), result.updates.end(), [](const FieldTagUpdate& a, const FieldTagUpdate& b) {
+        return a.block < b.block;
+    });
+
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static bool _fieldTagPrefix(const ReindexBlock& block, std::wstring& prefix) {
+    for (const std::wstring& fieldTag : block.fieldTags) {
+        size_t paren = fieldTag.find(L'(');
+        if (paren == std::wstring::npos) continue;
+
+        prefix.assign(fieldTag, 0, paren);
+        return true;
+    }
+
+    return false;
+}
+
+static bool _terminationType(BlockKind kind, bool& junction, CableType& cableType) {
+    switch (kind)
+    {
+    case BlockKind::JUNCTION_TERM :
+    case BlockKind::FIELD_DEV_TERM :
+        cableType = CableType::PAIR1;
+        break;
+
+    case BlockKind::JUNCTION_TERM7 :
+    case BlockKind::FIELD_DEV_TERM7 :
+        cableType = CableType::WIRE7;
+        break;
+
+    default:
+        return false;
+    }
+
+    junction = kind == BlockKind::JUNCTION_TERM || kind == BlockKind::JUNCTION_TERM7;
+    return true;
+}
+
+static const ReindexTable* _findTable(double x, const std::vector<const ReindexTable*>& tables) {
+    for (const ReindexTable* pTable : tables) {
+        for (double axis : { x - _fieldDeviceOffset, x + _fieldDeviceOffset }) {
+            if (axis >= pTable->left - _tolerance && axis <= pTable->right + _tolerance) return pTable;
+        }
+    }
+
+    return nullptr;
+}
+
+static void _renumber(const ReindexBlock& block, size_t index, CableType cableType, int firstTerminal, std::vector<FieldTagUpdate>& updates) {
+    int fieldTagCount = std::min(getFieldTagCount(cableType), static_cast<int>(block.fieldTags.size()));
+
+    for (int fieldTag = 1; fieldTag <= fieldTagCount; ++fieldTag) {
+        const std::wstring& text = block.fieldTags[fieldTag - 1];
+
+        size_t paren = text.find(L'(');
+        if (paren == std::wstring::npos) continue;
+
+        int terminal = getFieldTagTerminal(cableType, firstTerminal, fieldTag);
+        std::wstring renumbered = text.substr(0, paren) + L"(" + std::to_wstring(terminal) + L")";
+
+        if (renumbered != text) updates.push_back({ index, fieldTag, std::move(renumbered) });
+    }
+}
+
+static size_t _findFieldDevice(const std::vector<ReindexBlock>& blocks, size_t junction, const std::map<std::wstring, std::vector<size_t>>& fieldDevicesByTag) {
+    const ReindexBlock& block = blocks[junction];
+
+    auto it = fieldDevicesByTag.find(block.fieldTags[0]);
+    if (it == fieldDevicesByTag.end()) return UNRECORDED_BLOCK;
+
+    size_t found = UNRECORDED_BLOCK;
+    for (size_t f : it->second) {
+        const ReindexBlock& candidate = blocks[f];
+        if (std::abs(std::abs(candidate.x - block.x) - _fieldDeviceOffset) > _columnGap) continue;
+
+        if (found == UNRECORDED_BLOCK || std::abs(candidate.y - block.y) < std::abs(blocks[found].y - block.y)) found = f;
+    }
+
+    return found;
+}
+
+static bool _firstTerminal(const ReindexBlock& block, int& terminal) {
+    if (block.fieldTags.empty()) return false;
+
+    size_t paren = block.fieldTags[0].find(L'(');
+    if (paren == std::wstring::npos) return false;
+
+    terminal = static_cast<int>(std::wcstol(block.fieldTags[0].c_str() + paren + 1, nullptr, 10));
+    return true;
+}
@@ -0,0 +1,337 @@
+/**
+ * @file TerminalTable.cpp
+ * @brief Definitions for rebuilding the terminal table of a drawing.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "TerminalTable.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cwchar>
+#include <tuple>
+#include <unordered_map>
+
+// -----------------------------------------------------------------------------
+// Internal Constants
+// -----------------------------------------------------------------------------
+
+static const double _terminalPitch = 0.25;      ///< Vertical distance between two terminals.
+static const double _terminalRise = 0.125;      ///< Height of a device's first terminal above its cable's termination.
+static const double _cellSize = 1.0;            ///< Width and height of a grid cell.
+static const double _cableHeight = 16.0;        ///< Furthest a block is looked up above itself for its termination.
+static const double _axisTolerance = 0.01;      ///< Slack for matching a block to a termination's axis.
+static const double _tolerance = 1e-6;          ///< Slack for comparing drawing coordinates.
+
+// Horizontal distance of each block from its junction termination
+static const double _fieldDeviceOffset = 9.0;   ///< Field Device Termination.
+static const double _terminalOffset = 9.3438;   ///< TBWIREMINI.
+static const double _symbolOffset = 9.9375;     ///< INST SYMBOL.
+
+// -----------------------------------------------------------------------------
+// Internal Types
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief The blocks of one cable.
+ */
+struct _Cable {
+    const ScanBlock* pFieldDevice = nullptr;    ///< Its field device termination, or nullptr.
+    std::vector<const ScanBlock*> terminals;    ///< Its TBWIREMINI blocks.
+    std::vector<const ScanBlock*> symbols;      ///< Its INST SYMBOL blocks.
+};
+
+/**
+ * @brief Junction terminations bucketed by the grid cell of their insertion point.
+ */
+using _Grid = std::unordered_map<long long, std::vector<size_t>>;
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Get the grid cell of a coordinate.
+ */
+static long long _cell(double value);
+
+/**
+ * @brief Get the key of a grid cell.
+ */
+static long long _cellKey(long long column, long long row);
+
+/**
+ * @brief Get the text of a block's attribute.
+ *
+ * @return The text, or nullptr if the block has no such attribute.
+ */
+static const std::wstring* _attribute(const ScanBlock& block, const wchar_t* tag);
+
+/**
+ * @brief Split the FLDTAG1 of a junction termination into its parts.
+ *
+ * @return false if the block has no FLDTAG1 of the form "<junction>-TB<table>(<terminal>)".
+ */
+static bool _parseFieldTag(const ScanBlock& block, std::wstring& junctionTag, int& table, int& terminal);
+
+/**
+ * @brief Find the junction termination a block belongs to.
+ *
+ * @param block     The block.
+ * @param offset    Horizontal distance of the block from its termination.
+ * @param blocks    Every block.
+ * @param grid      The junction terminations.
+ * @return          Index of the termination in `blocks`, or -1 if none is found.
+ */
+static long long _findTermination(const ScanBlock& block, double offset, const std::vector<ScanBlock>& blocks, const _Grid& grid);
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+TerminalTable buildTerminalTable(const std::vector<ScanBlock>& blocks) {
+    TerminalTable result;
+
+    _Grid grid;
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        BlockKind kind = blocks[i].kind;
+        if (kind != BlockKind::JUNCTION_TERM && kind != BlockKind::JUNCTION_TERM7) continue;
+
+        grid[_cellKey(_cell(blocks[i].x), _cell(blocks[i].y))].push_back(i);
+    }
+
+    // Group every other block of a cable with its termination
+    std::unordered_map<size_t, _Cable> cables;
+    cables.reserve(grid.size() * 4);
+
+    for (const ScanBlock& block : blocks) {
+        double offset;
+        switch (block.kind)
+        {
+        case BlockKind::FIELD_DEV_TERM :
+        case BlockKind::FIELD_DEV_TERM7 :
+            offset = _fieldDeviceOffset;
+            break;
+
+        case BlockKind::TB_WIRE_MINI :
+            offset = _terminalOffset;
+            break;
+
+        case BlockKind::INST_SYMBOL :
+            offset = _symbolOffset;
+            break;
+
+        default:
+            continue;
+        }
+
+        long long termination = _findTermination(block, offset, blocks, grid);
+        if (termination < 0) {
+            result.unmatchedCount++;
+            continue;
+        }
+
+        _Cable& cable = cables[static_cast<size_t>(termination)];
+        if (block.kind == BlockKind::TB_WIRE_MINI) {
+            cable.terminals.push_back(&block);
+        } else if (block.kind == BlockKind::INST_SYMBOL) {
+            cable.symbols.push_back(&block);
+        } else {
+            cable.pFieldDevice = &block;
+        }
+    }
+
+    auto higher = [](const ScanBlock* a, const ScanBlock* b) { return a->y > b->y; };
+
+    for (const auto& entry : grid) {
+        for (size_t t : entry.second) {
+            const ScanBlock& termination = blocks[t];
+
+            DrawnCable drawn;
+            if (!_parseFieldTag(termination, drawn.junctionTag, drawn.table, drawn.firstTerminal)) {
+                result.unnumberedCount++;
+                continue;
+            }
+
+            drawn.visibility = termination.visibility;
+
+            auto it = cables.find(t);
+            if (it == cables.end()) {
+                result.cables.push_back(std::move(drawn));
+                continue;
+            }
+
+            _Cable& cable = it->second;
+            std::stable_sort(cable.terminals.begin(), cable.terminals.end(), higher);
+            std::stable_sort(cable.symbols.begin(), cable.symbols.end(), higher);
+
+            if (cable.pFieldDevice) {
+                const std::wstring* pLabel = _attribute(*cable.pFieldDevice, L"CL");
+                if (pLabel) drawn.cableLabel = *pLabel;
+            }
+
+            TerminalRow row;
+            row.junctionTag = drawn.junctionTag;
+            row.table = drawn.table;
+            row.cableLabel = drawn.cableLabel;
+
+            for (size_t i = 0; i < cable.terminals.size(); ++i) {
+                const ScanBlock& terminal = *cable.terminals[i];
+                const std::wstring* pWire = _attribute(terminal, L"#");
+                row.wire = pWire ? *pWire : std::wstring();
+
+                // Each device starts with its "+" (or "L") terminal
+                if (i == 0 || row.wire == L"+" || row.wire == L"L") {
+                    size_t device = drawn.devices.size();
+
+                    row.deviceTag.clear();
+                    if (device < cable.symbols.size()) {
+                        const std::wstring* pTag = _attribute(*cable.symbols[device], L"TAG");
+                        const std::wstring* pNumber = _attribute(*cable.symbols[device], L"NUMBER");
+                        if (pTag) row.deviceTag = *pTag;
+                        if (pNumber) row.deviceTag += L" " + *pNumber;
+                    }
+
+                    drawn.devices.emplace_back(row.deviceTag, 3);
+                }
+
+                if (row.wire == L"REF") drawn.devices.back().second = 4;
+                if (row.wire == L"L") drawn.devices.back().second = 6;
+
+                row.terminal = drawn.firstTerminal + static_cast<int>(std::round((termination.y + _terminalRise - terminal.y) / _terminalPitch));
+                result.rows.push_back(row);
+            }
+
+            result.cables.push_back(std::move(drawn));
+        }
+    }
+
+    std::sort(result.rows.begin(), result.rows.end(), [](const TerminalRow& a, const TerminalRow& b) {
+        return std::tie(a.junctionTag, a.table, a.terminal, a.wire) < std::tie(b.junctionTag, b.table, b.terminal, b.wire);
+    });
+
+    std::sort(result.cables.begin(), result.cables.end(), [](const DrawnCable& a, const DrawnCable& b) {
+        return std::tie(a.junctionTag, a.table, a.firstTerminal) < std::tie(b.junctionTag, b.table, b.firstTerminal);
+    });
+
+    return result;
+}
+
+std::vector<TerminalRow> getTerminalRows(const std::vector<Cable>& cables, const LayoutPlan& plan, const std::wstring& junctionTag) {
+    const std::vector<CablePlacement>& placements = plan.getPlacements();
+
+    std::vector<TerminalRow> rows;
+
+    for (size_t i = 0; i < cables.size() && i < placements.size(); ++i) {
+        TerminalRow row;
+        row.junctionTag = junctionTag;
+        row.table = placements[i].table;
+        row.cableLabel = getCableLabel(cables[i]);
+
+        int terminal = placements[i].terminal;
+        for (const Device& device : cables[i].getDevices()) {
+            std::string tag = device.getCombinedTag();
+            row.deviceTag.assign(tag.begin(), tag.end());
+
+            // The terminals drawDevice draws, by their distance below the first
+            int footprint = device.getTerminalFootprint();
+            std::vector<std::pair<int, const wchar_t*>> wires = { { 0, L"+" }, { 1, L"-" } };
+            if (footprint == 4) wires.push_back({ 2, L"REF" });
+            if (footprint == 6) wires = { { 0, L"L" }, { 1, L"N" }, { 3, L"5" }, { 4, L"6" } };
+
+            for (const auto& wire : wires) {
+                row.terminal = terminal + wire.first;
+                row.wire = wire.second;
+                rows.push_back(row);
+            }
+
+            terminal += footprint;
+        }
+    }
+
+    // Same order as buildTerminalTable
+    std::sort(rows.begin(), rows.end(), [](const TerminalRow& a, const TerminalRow& b) {
+        return std::tie(a.table, a.terminal, a.wire) < std::tie(b.table, b.terminal, b.wire);
+    });
+
+    return rows;
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static long long _cell(double value) {
+    return static_cast<long long>(std::floor(value / _cellSize));
+}
+
+static long long _cellKey(long long column, long long row) {
+    return (column << 32) ^ (row & 0xFFFFFFFFLL);
+}
+
+static const std::wstring* _attribute(const ScanBlock& block, const wchar_t* tag) {
+    for (const auto& attribute : block.attributes) {
+        if (attribute.first == tag) return &attribute.second;
+    }
+
+    return nullptr;
+}
+
+static bool _parseFieldTag(const ScanBlock& block, std::wstring& junctionTag, int& table, int& terminal) {
+    const std::wstring* pFieldTag = _attribute(block, L"FLDTAG1");
+    if (!pFieldTag) return false;
+
+    size_t paren = pFieldTag->find(L'(');
+    size_t tb = pFieldTag->rfind(L"-TB", paren);
+    if (paren == std::wstring::npos || tb == std::wstring::npos) return false;
+
+    wchar_t* end = nullptr;
+    table = static_cast<int>(std::wcstol(pFieldTag->c_str() + tb + 3, &end, 10));
+    if (end != pFieldTag->c_str() + paren) return false;
+
+    terminal = static_cast<int>(std::wcstol(pFieldTag->c_str() + paren + 1, &end, 10));
+    if (*end != L')') return false;
+
+    junctionTag.assign(*pFieldTag, 0, tb);
+    return true;
+}
+
+static long long _findTermination(const ScanBlock& block, double offset, const std::vector<ScanBlock>& blocks, const _Grid& grid) {
+    // Terminations below this belong to the cables underneath the block's
+    double lowest = block.y - _terminalRise - _tolerance;
+    long long bottomRow = _cell(lowest);
+    long long topRow = _cell(lowest + _cableHeight);
+
+    long long best = -1;
+
+    // The cable is drawn to the left or the right of its termination
+    for (double axis : { block.x + offset, block.x - offset }) {
+        long long found = -1;
+
+        for (long long row = bottomRow; row <= topRow && found < 0; ++row) {
+            for (long long column = _cell(axis - _axisTolerance); column <= _cell(axis + _axisTolerance); ++column) {
+                auto it = grid.find(_cellKey(column, row));
+                if (it == grid.end()) continue;
+
+                for (size_t t : it->second) {
+                    const ScanBlock& termination = blocks[t];
+                    if (std::fabs(termination.x - axis) > _axisTolerance || termination.y < lowest) continue;
+
+                    if (found < 0 || termination.y < blocks[found].y) found = static_cast<long long>(t);
+                }
+            }
+        }
+
+        if (found >= 0 && (best < 0 || blocks[found].y < blocks[best].y)) best = found;
+    }
+
+    return best;
+}
@@ -0,0 +1,193 @@
+/**
+ * @file Workbook.cpp
+ * @brief Definitions for the Workbook and WorkbookCache classes.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "Workbook.h"
+
+#include <stdexcept>
+
+#include "XlsxStreamReader.h"
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+std::shared_ptr<const Workbook> Workbook::open(const std::string& filename) {
+    std::shared_ptr<Workbook> workbook = std::make_shared<Workbook>();
+
+    std::unique_ptr<XlsxStreamReader> reader;
+    try {
+        reader = std::make_unique<XlsxStreamReader>(filename);
+    } catch (const std::exception& e) {
+        throw std::runtime_error(std::string("Failed to open Excel file: ") + e.what());
+    }
+
+    try {
+        // Only the columns the suite uses are read from each sheet
+        std::vector<XlsxTable> tables = reader->read({
+            { "Cable Schedule Data", 3, { 1, 3, 4 }, 4 },
+            { "IO List", 7, { 2, 5, 7, 8 }, 2 }
+        });
+
+        const XlsxTable& cableTable = tables[0];
+        const XlsxTable& ioTable = tables[1];
+
+        workbook->_cableSchedule.reserve(cableTable.size());
+        for (const XlsxRow& row : cableTable) {
+            CableScheduleRow scheduleRow;
+
+            // A string in the quantity column marks the start of a new cable
+            scheduleRow.newCable = row[0].isString;
+            if (scheduleRow.newCable) {
+                scheduleRow.quantity = row[0].value;
+            }
+
+            scheduleRow.junctionTag = row[1].value;
+            scheduleRow.combinedTag = row[2].value;
+
+            workbook->_cableSchedule.push_back(std::move(scheduleRow));
+        }
+
+        for (const XlsxRow& row : ioTable) {
+            IOListEntry entry;
+            entry.instrumentSpec = row[1].value;
+            entry.ioType = row[2].value;
+            entry.systemType = row[3].value;
+
+            workbook->_ioList.add(row[0].value, std::move(entry));
+        }
+    } catch (const std::exception& e) {
+        throw std::runtime_error(std::string("Excel file is not compatible: ") + e.what());
+    }
+
+    workbook->_partition();
+
+    return workbook;
+}
+
+std::vector<Cable> Workbook::getCables(const std::string& junctionTag) const {
+    auto it = _junctionIndex.find(junctionTag);
+    if (it == _junctionIndex.end()) return std::vector<Cable>();
+
+    const Junction& junction = _junctions[it->second];
+    if (!junction.error.empty()) {
+        throw std::runtime_error(junction.error);
+    }
+
+    return junction.cables;
+}
+
+std::vector<std::string> Workbook::getJunctionTags() const {
+    std::vector<std::string> tags;
+    tags.reserve(_junctions.size());
+
+    for (const Junction& junction : _junctions) {
+        if (junction.tag == "N/A") continue;
+
+        tags.push_back(junction.tag);
+    }
+
+    return tags;
+}
+
+const std::vector<Junction>& Workbook::getJunctions() const {
+    return _junctions;
+}
+
+const std::vector<CableScheduleRow>& Workbook::getCableSchedule() const {
+    return _cableSchedule;
+}
+
+const IOList& Workbook::getIOList() const {
+    return _ioList;
+}
+
+void Workbook::_partition() {
+    _junctions.clear();
+    _junctionIndex.clear();
+
+    for (const CableScheduleRow& row : _cableSchedule) {
+        // Find the junction's bucket, creating it the first time the tag is seen
+        auto inserted = _junctionIndex.emplace(row.junctionTag, _junctions.size());
+        if (inserted.second) {
+            _junctions.push_back(Junction{ row.junctionTag, {}, "" });
+        }
+
+        Junction& junction = _junctions[inserted.first->second];
+        if (!junction.error.empty()) continue;
+
+        try {
+            // Go find the respective info in IO List
+            const IOListEntry* ioEntry = _ioList.find(row.combinedTag);
+            if (!ioEntry) {
+                throw std::runtime_error("Device in Cable Schedule Data does not exist in IO List");
+            }
+
+            SystemType systemType = Cable::getSystemTypeFromCell(ioEntry->systemType);
+            IOType ioType = Cable::getIOTypeFromCell(ioEntry->ioType);
+
+            if (row.newCable) {
+                // We are on a new cable
+                junction.cables.push_back(Cable(
+                    Cable::getWireTypeFromCell(row.quantity),
+                    systemType,
+                    ioType
+                ));
+            }
+
+            // Add the current device to the cable
+            int deviceFootprint = Device::footprintFromCells(row.combinedTag, ioEntry->instrumentSpec);
+            Device device(row.combinedTag, deviceFootprint);
+
+            if (!junction.cables.empty()) {
+                junction.cables.back().addDevice(device);
+            }
+        } catch (const std::exception& e) {
+            junction.cables.clear();
+            junction.error = std::string("Excel file is not compatible: ") + e.what();
+        }
+    }
+}
+
+std::shared_ptr<const Workbook> WorkbookCache::get(const std::string& filename) {
+    std::error_code ec;
+    std::uintmax_t fileSize = std::filesystem::file_size(filename, ec);
+    if (ec) {
+        throw std::runtime_error("Failed to open Excel file: " + ec.message());
+    }
+
+    std::filesystem::file_time_type modified = std::filesystem::last_write_time(filename, ec);
+    if (ec) {
+        throw std::runtime_error("Failed to open Excel file: " + ec.message());
+    }
+
+    if (_workbook && _filename == filename && _fileSize == fileSize && _modified == modified) {
+        return _workbook;
+    }
+
+    // Drop the stale workbook before parsing so a failed parse leaves the cache empty
+    clear();
+
+    _workbook = Workbook::open(filename);
+    _filename = filename;
+    _fileSize = fileSize;
+    _modified = modified;
+
+    return _workbook;
+}
+
+void WorkbookCache::clear() {
+    _workbook.reset();
+    _filename.clear();
+    _fileSize = 0;
+}
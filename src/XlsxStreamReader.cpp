@@ -0,0 +1,798 @@
+/**
+ * @file XlsxStreamReader.cpp
+ * @brief Definitions for the XlsxStreamReader class.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include "XlsxStreamReader.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+
+#include <zlib.h>
+
+// -----------------------------------------------------------------------------
+// Internal Types
+// -----------------------------------------------------------------------------
+
+namespace {
+
+/**
+ * @class ZipEntryStream
+ * @brief Inflates a single archive part in fixed size chunks.
+ */
+class ZipEntryStream
+{
+private:
+    std::ifstream& _file;      ///< Archive positioned at the part's data.
+    uint16_t _method;          ///< Compression method (0 = stored, 8 = deflate).
+    uint32_t _remaining;       ///< Bytes of compressed data not yet read from the file.
+    z_stream _zs{};            ///< zlib state for deflated parts.
+    std::vector<char> _input;  ///< Compressed data read from the file but not yet inflated.
+    bool _finished = false;    ///< true once the end of the part has been reached.
+
+public:
+    ZipEntryStream(std::ifstream& file, uint16_t method, uint32_t offset, uint32_t compressedSize) :
+    _file(file),
+    _method(method),
+    _remaining(compressedSize),
+    _input(64 * 1024)
+    {
+        if (_method != 0 && _method != 8) {
+            throw std::runtime_error("Unsupported compression method in workbook");
+        }
+
+        // Skip the local file header, whose name and extra field lengths may
+        // differ from the central directory
+        unsigned char header[30];
+        _file.clear();
+        _file.seekg(offset);
+        if (!_file.read(reinterpret_cast<char*>(header), sizeof(header)) ||
+            header[0] != 'P' || header[1] != 'K' || header[2] != 3 || header[3] != 4) {
+            throw std::runtime_error("Corrupt workbook archive");
+        }
+
+        uint16_t nameLength = header[26] | (header[27] << 8);
+        uint16_t extraLength = header[28] | (header[29] << 8);
+        _file.seekg(nameLength + extraLength, std::ios::cur);
+
+        if (_method == 8 && inflateInit2(&_zs, -MAX_WBITS) != Z_OK) {
+            throw std::runtime_error("Failed to initialise inflate");
+        }
+    }
+
+    ~ZipEntryStream() {
+        if (_method == 8) inflateEnd(&_zs);
+    }
+
+    ZipEntryStream(const ZipEntryStream&) = delete;
+    ZipEntryStream& operator=(const ZipEntryStream&) = delete;
+
+    /**
+     * @brief Read up to `size` inflated bytes.
+     *
+     * @return The number of bytes written to `out`. 0 once the part is exhausted.
+     */
+    size_t read(char* out, size_t size) {
+        if (_finished) return 0;
+
+        if (_method == 0) {
+            size_t count = std::min<size_t>(size, _remaining);
+            _file.read(out, count);
+            if (static_cast<size_t>(_file.gcount()) != count) {
+                throw std::runtime_error("Corrupt workbook archive");
+            }
+            _remaining -= static_cast<uint32_t>(count);
+            _finished = _remaining == 0;
+            return count;
+        }
+
+        _zs.next_out = reinterpret_cast<Bytef*>(out);
+        _zs.avail_out = static_cast<uInt>(size);
+
+        while (_zs.avail_out > 0) {
+            if (_zs.avail_in == 0 && _remaining > 0) {
+                size_t count = std::min<size_t>(_input.size(), _remaining);
+                _file.read(_input.data(), count);
+                if (static_cast<size_t>(_file.gcount()) != count) {
+                    throw std::runtime_error("Corrupt workbook archive");
+                }
+                _remaining -= static_cast<uint32_t>(count);
+                _zs.next_in = reinterpret_cast<Bytef*>(_input.data());
+                _zs.avail_in = static_cast<uInt>(count);
+            }
+
+            int status = inflate(&_zs, Z_NO_FLUSH);
+            if (status == Z_STREAM_END) {
+                _finished = true;
+                break;
+            }
+            if (status != Z_OK && !(status == Z_BUF_ERROR && _zs.avail_in == 0 && _remaining > 0)) {
+                throw std::runtime_error("Corrupt workbook archive");
+            }
+        }
+
+        return size - _zs.avail_out;
+    }
+};
+
+/**
+ * @class XmlPullParser
+ * @brief Minimal forward-only XML tokenizer over a ZipEntryStream.
+ *
+ * Names and text returned by the parser point into its internal buffer and are
+ * only valid until the next call to `next()`.
+ */
+class XmlPullParser
+{
+public:
+    /**
+     * @enum Event
+     * @brief The kinds of token returned by `next()`.
+     */
+    enum Event {
+        START_ELEMENT, ///< An opening tag. `<a/>` is reported as a START_ELEMENT followed by an END_ELEMENT.
+        END_ELEMENT,   ///< A closing tag.
+        TEXT,          ///< Character data between tags (still entity encoded).
+        END_DOCUMENT   ///< The end of the part.
+    };
+
+private:
+    ZipEntryStream& _source;   ///< Where the XML is read from.
+    std::string _buffer;       ///< Inflated XML not yet consumed.
+    size_t _pos = 0;           ///< Position of the next token in `_buffer`.
+    bool _eof = false;         ///< true once `_source` is exhausted.
+    bool _pendingEnd = false;  ///< true if the last START_ELEMENT was self closing.
+    std::string_view _name;    ///< Local name of the current element.
+    std::string_view _attrs;   ///< Raw attribute text of the current START_ELEMENT.
+    std::string_view _text;    ///< Character data of the current TEXT event.
+    bool _rawText = false;     ///< true if `_text` came from a CDATA section and must not be decoded.
+
+    /**
+     * @brief Append another chunk from the source to the buffer.
+     *
+     * @return false if the source is exhausted.
+     */
+    bool _fill() {
+        if (_eof) return false;
+
+        const size_t chunk = 64 * 1024;
+        size_t size = _buffer.size();
+        _buffer.resize(size + chunk);
+        size_t count = _source.read(&_buffer[size], chunk);
+        _buffer.resize(size + count);
+
+        if (count == 0) _eof = true;
+        return count > 0;
+    }
+
+    /**
+     * @brief Find `token` at or after `from`, reading more input as needed.
+     *
+     * @return The position of `token`, or npos if the part ends first.
+     */
+    size_t _find(const char* token, size_t from) {
+        size_t length = std::strlen(token);
+        for (;;) {
+            size_t found = _buffer.find(token, from);
+            if (found != std::string::npos) return found;
+
+            // The token may straddle the chunk boundary
+            if (_buffer.size() >= length) from = std::max(from, _buffer.size() - length + 1);
+            if (!_fill()) return std::string::npos;
+        }
+    }
+
+    /**
+     * @brief Find the '>' closing a tag, ignoring any inside quoted attribute values.
+     */
+    size_t _findTagEnd(size_t from) {
+        char quote = 0;
+        for (size_t i = from;; ++i) {
+            if (i == _buffer.size() && !_fill()) return std::string::npos;
+
+            char c = _buffer[i];
+            if (quote) {
+                if (c == quote) quote = 0;
+            } else if (c == '"' || c == '\'') {
+                quote = c;
+            } else if (c == '>') {
+                return i;
+            }
+        }
+    }
+
+    static bool _isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    }
+
+    static std::string_view _localName(std::string_view name) {
+        size_t colon = name.find(':');
+        return colon == std::string_view::npos ? name : name.substr(colon + 1);
+    }
+
+public:
+    explicit XmlPullParser(ZipEntryStream& source) : _source(source) {}
+
+    /**
+     * @brief Advance to the next token.
+     */
+    Event next() {
+        if (_pendingEnd) {
+            _pendingEnd = false;
+            return END_ELEMENT;
+        }
+
+        for (;;) {
+            // Discard consumed input so the buffer stays a few chunks long
+            if (_pos > 64 * 1024) {
+                _buffer.erase(0, _pos);
+                _pos = 0;
+            }
+
+            if (_pos == _buffer.size() && !_fill()) return END_DOCUMENT;
+
+            if (_buffer[_pos] != '<') {
+                size_t end = _find("<", _pos);
+                if (end == std::string::npos) end = _buffer.size();
+
+                _text = std::string_view(_buffer).substr(_pos, end - _pos);
+                _rawText = false;
+                _pos = end;
+                return TEXT;
+            }
+
+            // Make sure enough of the markup is buffered to tell what it is
+            while (_buffer.size() - _pos < 9 && _fill()) {}
+            if (_buffer.size() - _pos < 2) {
+                throw std::runtime_error("Malformed XML in workbook");
+            }
+
+            char kind = _buffer[_pos + 1];
+
+            if (kind == '?') {
+                size_t end = _find("?>", _pos);
+                if (end == std::string::npos) throw std::runtime_error("Malformed XML in workbook");
+                _pos = end + 2;
+                continue;
+            }
+
+            if (kind == '!') {
+                if (_buffer.compare(_pos, 4, "<!--") == 0) {
+                    size_t end = _find("-->", _pos + 4);
+                    if (end == std::string::npos) throw std::runtime_error("Malformed XML in workbook");
+                    _pos = end + 3;
+                    continue;
+                }
+
+                if (_buffer.compare(_pos, 9, "<![CDATA[") == 0) {
+                    size_t end = _find("]]>", _pos + 9);
+                    if (end == std::string::npos) throw std::runtime_error("Malformed XML in workbook");
+                    _text = std::string_view(_buffer).substr(_pos + 9, end - _pos - 9);
+                    _rawText = true;
+                    _pos = end + 3;
+                    return TEXT;
+                }
+
+                size_t end = _findTagEnd(_pos);
+                if (end == std::string::npos) throw std::runtime_error("Malformed XML in workbook");
+                _pos = end + 1;
+                continue;
+            }
+
+            size_t end = _findTagEnd(_pos);
+            if (end == std::string::npos) throw std::runtime_error("Malformed XML in workbook");
+
+            std::string_view tag = std::string_view(_buffer).substr(_pos + 1, end - _pos - 1);
+            _pos = end + 1;
+
+            if (!tag.empty() && tag[0] == '/') {
+                tag.remove_prefix(1);
+                while (!tag.empty() && _isSpace(tag.back())) tag.remove_suffix(1);
+                _name = _localName(tag);
+                return END_ELEMENT;
+            }
+
+            bool selfClosing = !tag.empty() && tag.back() == '/';
+            if (selfClosing) tag.remove_suffix(1);
+
+            size_t nameEnd = 0;
+            while (nameEnd < tag.size() && !_isSpace(tag[nameEnd])) ++nameEnd;
+
+            _name = _localName(tag.substr(0, nameEnd));
+            _attrs = tag.substr(nameEnd);
+            _pendingEnd = selfClosing;
+            return START_ELEMENT;
+        }
+    }
+
+    /**
+     * @brief Local name (without namespace prefix) of the current element.
+     */
+    std::string_view name() const {
+        return _name;
+    }
+
+    /**
+     * @brief Append the decoded character data of the current TEXT event to `out`.
+     */
+    void appendText(std::string& out) const {
+        if (_rawText) {
+            out.append(_text);
+        } else {
+            decode(_text, out);
+        }
+    }
+
+    /**
+     * @brief Read an attribute of the current START_ELEMENT.
+     *
+     * @param localName Attribute name without namespace prefix (e.g. "id" for "r:id").
+     * @param out       Receives the decoded value.
+     * @return          true if the attribute is present.
+     */
+    bool attribute(std::string_view localName, std::string& out) const {
+        size_t i = 0;
+        while (i < _attrs.size()) {
+            while (i < _attrs.size() && _isSpace(_attrs[i])) ++i;
+
+            size_t keyStart = i;
+            while (i < _attrs.size() && _attrs[i] != '=' && !_isSpace(_attrs[i])) ++i;
+            std::string_view key = _attrs.substr(keyStart, i - keyStart);
+
+            while (i < _attrs.size() && (_isSpace(_attrs[i]) || _attrs[i] == '=')) ++i;
+            if (i >= _attrs.size()) break;
+
+            char quote = _attrs[i++];
+            size_t valueEnd = _attrs.find(quote, i);
+            if (valueEnd == std::string_view::npos) break;
+
+            if (_localName(key) == localName) {
+                out.clear();
+                decode(_attrs.substr(i, valueEnd - i), out);
+                return true;
+            }
+
+            i = valueEnd + 1;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Append `text` to `out`, replacing XML entity and character references.
+     */
+    static void decode(std::string_view text, std::string& out) {
+        size_t i = 0;
+        while (i < text.size()) {
+            size_t amp = text.find('&', i);
+            if (amp == std::string_view::npos) {
+                out.append(text.substr(i));
+                return;
+            }
+
+            out.append(text.substr(i, amp - i));
+
+            size_t semi = text.find(';', amp);
+            if (semi == std::string_view::npos) {
+                out.append(text.substr(amp));
+                return;
+            }
+
+            std::string_view entity = text.substr(amp + 1, semi - amp - 1);
+            if (entity == "amp") out += '&';
+            else if (entity == "lt") out += '<';
+            else if (entity == "gt") out += '>';
+            else if (entity == "quot") out += '"';
+            else if (entity == "apos") out += '\'';
+            else if (!entity.empty() && entity[0] == '#') {
+                std::string digits(entity.substr(1));
+                unsigned long code = (!digits.empty() && (digits[0] == 'x' || digits[0] == 'X'))
+                    ? std::strtoul(digits.c_str() + 1, nullptr, 16)
+                    : std::strtoul(digits.c_str(), nullptr, 10);
+
+                // Encode the code point as UTF-8
+                if (code < 0x80) {
+                    out += static_cast<char>(code);
+                } else if (code < 0x800) {
+                    out += static_cast<char>(0xC0 | (code >> 6));
+                    out += static_cast<char>(0x80 | (code & 0x3F));
+                } else if (code < 0x10000) {
+                    out += static_cast<char>(0xE0 | (code >> 12));
+                    out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                    out += static_cast<char>(0x80 | (code & 0x3F));
+                } else {
+                    out += static_cast<char>(0xF0 | (code >> 18));
+                    out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+                    out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                    out += static_cast<char>(0x80 | (code & 0x3F));
+                }
+            } else {
+                out.append(text.substr(amp, semi - amp + 1));
+            }
+
+            i = semi + 1;
+        }
+    }
+};
+
+/**
+ * @struct SharedStringRef
+ * @brief A returned cell whose value is still an index into the shared string table.
+ */
+struct SharedStringRef {
+    size_t table;   ///< Index of the query.
+    size_t row;     ///< Row within the query's table.
+    size_t slot;    ///< Column within the row.
+    uint32_t index; ///< Index into the shared string table.
+};
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+uint16_t _readU16(const unsigned char* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+uint32_t _readU32(const unsigned char* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+/**
+ * @brief Split a cell reference (e.g. "AB12") into its 1 based column.
+ */
+uint16_t _columnFromReference(const std::string& reference) {
+    uint32_t column = 0;
+    for (char c : reference) {
+        if (c >= 'A' && c <= 'Z') column = column * 26 + (c - 'A' + 1);
+        else if (c >= 'a' && c <= 'z') column = column * 26 + (c - 'a' + 1);
+        else break;
+    }
+    return static_cast<uint16_t>(column);
+}
+
+/**
+ * @brief Resolve a relationship target relative to the "xl/" folder.
+ */
+std::string _resolvePart(const std::string& target) {
+    if (!target.empty() && target[0] == '/') return target.substr(1);
+    return "xl/" + target;
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+XlsxStreamReader::XlsxStreamReader(const std::string& filename) :
+_file(filename, std::ios::binary)
+{
+    if (!_file) {
+        throw std::runtime_error("Unable to open " + filename);
+    }
+
+    _readCentralDirectory();
+    _readWorkbook();
+}
+
+bool XlsxStreamReader::hasSheet(const std::string& sheetName) const {
+    return _sheetParts.find(sheetName) != _sheetParts.end();
+}
+
+std::vector<XlsxTable> XlsxStreamReader::read(const std::vector<XlsxSheetQuery>& queries) {
+    std::vector<XlsxTable> tables(queries.size());
+    std::vector<SharedStringRef> refs;
+
+    for (size_t t = 0; t < queries.size(); ++t) {
+        const XlsxSheetQuery& query = queries[t];
+
+        auto part = _sheetParts.find(query.sheetName);
+        if (part == _sheetParts.end()) {
+            throw std::runtime_error("Worksheet '" + query.sheetName + "' does not exist");
+        }
+
+        // Map each requested column to its slot in the returned rows
+        uint16_t maxColumn = *std::max_element(query.columns.begin(), query.columns.end());
+        std::vector<int> slots(maxColumn + 1, -1);
+        for (size_t i = 0; i < query.columns.size(); ++i) {
+            slots[query.columns[i]] = static_cast<int>(i);
+        }
+
+        if (query.stopColumn > maxColumn || slots[query.stopColumn] < 0) {
+            throw std::invalid_argument("Stop column must be one of the requested columns");
+        }
+        size_t stopSlot = slots[query.stopColumn];
+
+        const _ZipEntry& entry = _entry(part->second);
+        ZipEntryStream stream(_file, entry.method, entry.localHeaderOffset, entry.compressedSize);
+        XmlPullParser xml(stream);
+
+        XlsxTable& table = tables[t];
+        uint32_t expectedRow = query.firstRow;
+        uint32_t rowNumber = 0;
+        uint16_t columnNumber = 0;
+        bool inRow = false;     // Inside a row that is being kept
+        int slot = -1;          // Slot of the current cell, -1 if it is skipped
+        bool sharedString = false;
+        bool stopIsShared = false; // The current row's stop column holds a shared string
+        bool inValue = false;   // Inside <v> or the <t> of an inline string
+        int phonetic = 0;       // Depth of <rPh> elements, whose text is not part of the value
+        std::string attr;
+        std::string value;
+        bool done = false;
+
+        while (!done) {
+            XmlPullParser::Event event = xml.next();
+            if (event == XmlPullParser::END_DOCUMENT) break;
+
+            std::string_view name = xml.name();
+
+            if (event == XmlPullParser::START_ELEMENT) {
+                if (name == "row") {
+                    rowNumber = xml.attribute("r", attr) ? static_cast<uint32_t>(std::strtoul(attr.c_str(), nullptr, 10)) : rowNumber + 1;
+                    columnNumber = 0;
+
+                    if (rowNumber < query.firstRow) continue;
+
+                    // A missing row is an empty row, which ends the table
+                    if (rowNumber > expectedRow) {
+                        done = true;
+                        continue;
+                    }
+
+                    table.emplace_back(query.columns.size());
+                    inRow = true;
+                    stopIsShared = false;
+                } else if (name == "c" && inRow) {
+                    columnNumber = xml.attribute("r", attr) ? _columnFromReference(attr) : columnNumber + 1;
+                    slot = columnNumber <= maxColumn ? slots[columnNumber] : -1;
+                    if (slot < 0) continue;
+
+                    if (!xml.attribute("t", attr)) attr = "n";
+                    sharedString = attr == "s";
+                    table.back()[slot].isString = attr == "s" || attr == "str" || attr == "inlineStr";
+                    value.clear();
+                } else if (slot >= 0 && inRow) {
+                    if (name == "v" || (name == "t" && phonetic == 0)) inValue = true;
+                    else if (name == "rPh") phonetic++;
+                }
+            } else if (event == XmlPullParser::TEXT) {
+                if (inValue) xml.appendText(value);
+            } else {
+                if (name == "v" || name == "t") {
+                    inValue = false;
+                } else if (name == "rPh") {
+                    phonetic--;
+                } else if (name == "c" && slot >= 0 && inRow) {
+                    XlsxCell& cell = table.back()[slot];
+                    if (sharedString) {
+                        refs.push_back({ t, table.size() - 1, static_cast<size_t>(slot),
+                                         static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10)) });
+                        if (static_cast<size_t>(slot) == stopSlot) stopIsShared = true;
+                    } else {
+                        cell.value = value;
+                    }
+                    slot = -1;
+                } else if (name == "row" && inRow) {
+                    inRow = false;
+
+                    if (table.back()[stopSlot].value.empty() && !stopIsShared) {
+                        // Drop the row along with any of its strings still waiting to be resolved
+                        while (!refs.empty() && refs.back().table == t && refs.back().row == table.size() - 1) {
+                            refs.pop_back();
+                        }
+                        table.pop_back();
+                        done = true;
+                    } else {
+                        expectedRow++;
+                    }
+                } else if (name == "sheetData") {
+                    done = true;
+                }
+            }
+        }
+    }
+
+    if (refs.empty()) return tables;
+
+    // Resolve the referenced shared strings in a single pass over the table,
+    // keeping only the strings that are actually used
+    std::vector<uint32_t> needed;
+    needed.reserve(refs.size());
+    for (const SharedStringRef& ref : refs) needed.push_back(ref.index);
+    std::sort(needed.begin(), needed.end());
+    needed.erase(std::unique(needed.begin(), needed.end()), needed.end());
+
+    std::vector<std::string> strings(needed.size());
+
+    if (!_sharedStringsPart.empty()) {
+        const _ZipEntry& entry = _entry(_sharedStringsPart);
+        ZipEntryStream stream(_file, entry.method, entry.localHeaderOffset, entry.compressedSize);
+        XmlPullParser xml(stream);
+
+        uint32_t index = 0;
+        size_t next = 0;
+        bool inText = false;
+        int phonetic = 0;
+        std::string value;
+
+        while (next < needed.size()) {
+            XmlPullParser::Event event = xml.next();
+            if (event == XmlPullParser::END_DOCUMENT) break;
+
+            std::string_view name = xml.name();
+            bool wanted = needed[next] == index;
+
+            if (event == XmlPullParser::START_ELEMENT) {
+                if (name == "si") value.clear();
+                else if (name == "rPh") phonetic++;
+                else if (name == "t" && phonetic == 0 && wanted) inText = true;
+            } else if (event == XmlPullParser::TEXT) {
+                if (inText) xml.appendText(value);
+            } else {
+                if (name == "t") {
+                    inText = false;
+                } else if (name == "rPh") {
+                    phonetic--;
+                } else if (name == "si") {
+                    if (wanted) strings[next++] = std::move(value);
+                    value.clear();
+                    index++;
+                }
+            }
+        }
+    }
+
+    for (const SharedStringRef& ref : refs) {
+        size_t i = std::lower_bound(needed.begin(), needed.end(), ref.index) - needed.begin();
+        tables[ref.table][ref.row][ref.slot].value = strings[i];
+    }
+
+    // A shared string can be empty, which also ends the table
+    for (size_t t = 0; t < queries.size(); ++t) {
+        const XlsxSheetQuery& query = queries[t];
+        size_t stopSlot = std::find(query.columns.begin(), query.columns.end(), query.stopColumn) - query.columns.begin();
+
+        XlsxTable& table = tables[t];
+        for (size_t row = 0; row < table.size(); ++row) {
+            if (table[row][stopSlot].value.empty()) {
+                table.resize(row);
+                break;
+            }
+        }
+    }
+
+    return tables;
+}
+
+void XlsxStreamReader::_readCentralDirectory() {
+    // The end of central directory record is in the last 64 KiB + 22 bytes
+    _file.seekg(0, std::ios::end);
+    std::streamoff fileSize = _file.tellg();
+    std::streamoff tailSize = std::min<std::streamoff>(fileSize, 0xFFFF + 22);
+
+    std::vector<unsigned char> tail(static_cast<size_t>(tailSize));
+    _file.seekg(fileSize - tailSize);
+    _file.read(reinterpret_cast<char*>(tail.data()), tailSize);
+
+    const unsigned char* eocd = nullptr;
+    for (std::streamoff i = tailSize - 22; i >= 0; --i) {
+        if (_readU32(&tail[i]) == 0x06054b50) {
+            eocd = &tail[i];
+            break;
+        }
+    }
+
+    if (!eocd) {
+        throw std::runtime_error("File is not a workbook");
+    }
+
+    uint16_t entryCount = _readU16(eocd + 10);
+    uint32_t directorySize = _readU32(eocd + 12);
+    uint32_t directoryOffset = _readU32(eocd + 16);
+
+    if (entryCount == 0xFFFF || directoryOffset == 0xFFFFFFFF) {
+        throw std::runtime_error("ZIP64 workbooks are not supported");
+    }
+
+    std::vector<unsigned char> directory(directorySize);
+    _file.seekg(directoryOffset);
+    if (!_file.read(reinterpret_cast<char*>(directory.data()), directorySize)) {
+        throw std::runtime_error("Corrupt workbook archive");
+    }
+
+    size_t pos = 0;
+    for (uint16_t i = 0; i < entryCount; ++i) {
+        if (pos + 46 > directory.size() || _readU32(&directory[pos]) != 0x02014b50) {
+            throw std::runtime_error("Corrupt workbook archive");
+        }
+
+        const unsigned char* header = &directory[pos];
+        uint16_t nameLength = _readU16(header + 28);
+        uint16_t extraLength = _readU16(header + 30);
+        uint16_t commentLength = _readU16(header + 32);
+
+        if (pos + 46 + nameLength > directory.size()) {
+            throw std::runtime_error("Corrupt workbook archive");
+        }
+
+        _ZipEntry entry;
+        entry.method = _readU16(header + 10);
+        entry.compressedSize = _readU32(header + 20);
+        entry.uncompressedSize = _readU32(header + 24);
+        entry.localHeaderOffset = _readU32(header + 42);
+
+        _entries.emplace(std::string(reinterpret_cast<const char*>(header + 46), nameLength), entry);
+
+        pos += 46 + nameLength + extraLength + commentLength;
+    }
+}
+
+void XlsxStreamReader::_readWorkbook() {
+    // Relationship id -> part, from the workbook's relationships
+    std::unordered_map<std::string, std::string> targets;
+    {
+        const _ZipEntry& entry = _entry("xl/_rels/workbook.xml.rels");
+        ZipEntryStream stream(_file, entry.method, entry.localHeaderOffset, entry.compressedSize);
+        XmlPullParser xml(stream);
+
+        std::string id;
+        std::string target;
+        std::string type;
+        for (XmlPullParser::Event event = xml.next(); event != XmlPullParser::END_DOCUMENT; event = xml.next()) {
+            if (event != XmlPullParser::START_ELEMENT || xml.name() != "Relationship") continue;
+            if (!xml.attribute("Id", id) || !xml.attribute("Target", target)) continue;
+
+            targets[id] = _resolvePart(target);
+
+            if (xml.attribute("Type", type) && type.size() >= 14 &&
+                type.compare(type.size() - 14, 14, "/sharedStrings") == 0) {
+                _sharedStringsPart = _resolvePart(target);
+            }
+        }
+    }
+
+    // Sheet name -> relationship id, from the workbook
+    const _ZipEntry& entry = _entry("xl/workbook.xml");
+    ZipEntryStream stream(_file, entry.method, entry.localHeaderOffset, entry.compressedSize);
+    XmlPullParser xml(stream);
+
+    std::string name;
+    std::string id;
+    for (XmlPullParser::Event event = xml.next(); event != XmlPullParser::END_DOCUMENT; event = xml.next()) {
+        if (event != XmlPullParser::START_ELEMENT || xml.name() != "sheet") continue;
+        if (!xml.attribute("name", name) || !xml.attribute("id", id)) continue;
+
+        auto target = targets.find(id);
+        if (target != targets.end()) {
+            _sheetParts[name] = target->second;
+        }
+    }
+
+    if (!_sharedStringsPart.empty() && _entries.find(_sharedStringsPart) == _entries.end()) {
+        _sharedStringsPart.clear();
+    }
+}
+
+const XlsxStreamReader::_ZipEntry& XlsxStreamReader::_entry(const std::string& path) const {
+    auto it = _entries.find(path);
+    if (it == _entries.end()) {
+        throw std::runtime_error("Workbook is missing " + path);
+    }
+
+    return it->second;
+}
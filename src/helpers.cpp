@@ -14,13 +14,94 @@
 
 #include "helpers.h"
 
+// -----------------------------------------------------------------------------
+// Internal State
+// -----------------------------------------------------------------------------
+
+static AcadOpenCounter _openCounter;  ///< Opens and closes since the last reset.
+static int _transactionDepth = 0;     ///< Number of transactions started with `acadStartTransaction`.
+static long _transactionOpens = 0;    ///< Objects fetched through the outermost transaction.
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Hand an object that was just added to the database back to AutoCAD.
+ *
+ * Inside a transaction the object is added to it, otherwise it is closed.
+ */
+static void _releaseNewObject(AcDbObject* pObj);
+
 // -----------------------------------------------------------------------------
 // Function Definitions
 // -----------------------------------------------------------------------------
 
-AcDbObjectId acadInsertBlock(const wchar_t* blockName, const AcGePoint3d& origin) {
-    AcDbObjectId blockRefId;
+AcadOpenCounter acadGetOpenCounter() {
+    return _openCounter;
+}
+
+void acadResetOpenCounter() {
+    _openCounter = AcadOpenCounter();
+}
+
+Acad::ErrorStatus acadStartTransaction() {
+    if (!actrTransactionManager->startTransaction()) {
+        acutPrintf(L"\nError: Could not start a transaction.");
+        return Acad::eNotInTransaction;
+    }
+
+    _transactionDepth++;
+    return Acad::eOk;
+}
 
+Acad::ErrorStatus acadEndTransaction(bool commit) {
+    if (_transactionDepth == 0) return Acad::eNotInTransaction;
+
+    Acad::ErrorStatus es = commit ? actrTransactionManager->endTransaction()
+                                  : actrTransactionManager->abortTransaction();
+
+    // Every object fetched through the transaction is closed once the outermost one ends
+    if (--_transactionDepth == 0) {
+        _openCounter.closes += _transactionOpens;
+        _transactionOpens = 0;
+    }
+
+    return es;
+}
+
+Acad::ErrorStatus acadOpenObject(AcDbObject*& pObj, const AcDbObjectId& objId, AcDb::OpenMode mode) {
+    pObj = nullptr;
+
+    Acad::ErrorStatus es;
+    if (_transactionDepth > 0) {
+        es = actrTransactionManager->getObject(pObj, objId, mode);
+    } else {
+        es = acdbOpenObject(pObj, objId, mode);
+    }
+
+    if (es != Acad::eOk || !pObj) {
+        pObj = nullptr;
+        return (es != Acad::eOk) ? es : Acad::eNullObjectPointer;
+    }
+
+    _openCounter.opens++;
+    if (_transactionDepth > 0) _transactionOpens++;
+
+    return Acad::eOk;
+}
+
+void acadCloseObject(AcDbObject* pObj) {
+    if (!pObj) return;
+
+    // Objects fetched through a transaction are closed when it ends
+    if (_transactionDepth > 0) return;
+
+    pObj->close();
+    _openCounter.closes++;
+}
+
+AcDbObjectId acadInsertBlock(const wchar_t* blockName, const AcGePoint3d& origin) {
     // Get the current working database
     AcDbDatabase* pDb = acdbHostApplicationServices()->workingDatabase();
     if (!pDb) {
@@ -30,83 +111,101 @@ AcDbObjectId acadInsertBlock(const wchar_t* blockName, const AcGePoint3d& origin
 
     // Open the block table for reading
     AcDbBlockTable* pBlockTable = nullptr;
-    if (pDb->getBlockTable(pBlockTable, AcDb::kForRead) != Acad::eOk || !pBlockTable) {
+    if (acadOpenObject(pBlockTable, pDb->blockTableId(), AcDb::kForRead) != Acad::eOk) {
         acutPrintf(L"\nError: Could not access block table.");
         return AcDbObjectId::kNull;
     }
 
-    // Get the ObjectId of the block definition
-    AcDbObjectId blockDefId;
-    if (pBlockTable->getAt(blockName, blockDefId) != Acad::eOk || !blockDefId) {
-        acutPrintf(L"\nError: Block '%ls' not found in drawing.", blockName);
-        pBlockTable->close();
-        return AcDbObjectId::kNull;
-    }
-
-    // Create a new block reference at the given origin
-    AcDbBlockReference* pBlockRef = new AcDbBlockReference(origin, blockDefId);
-
     // Open Model Space for writing
+    AcDbObjectId modelSpaceId;
     AcDbBlockTableRecord* pModelSpace = nullptr;
-    if (pBlockTable->getAt(ACDB_MODEL_SPACE, pModelSpace, AcDb::kForWrite) != Acad::eOk) {
-        pBlockRef->close();
-        pBlockTable->close();
+    if (pBlockTable->getAt(ACDB_MODEL_SPACE, modelSpaceId) != Acad::eOk ||
+        acadOpenObject(pModelSpace, modelSpaceId, AcDb::kForWrite) != Acad::eOk) {
+        acadCloseObject(pBlockTable);
         return AcDbObjectId::kNull;
     }
 
-    // Add the block reference to Model Space
-    if (pModelSpace->appendAcDbEntity(blockRefId, pBlockRef) != Acad::eOk) {
-        acutPrintf(L"\nError: Failed to insert block reference.");
-        pBlockRef->close();
-        pModelSpace->close();
-        pBlockTable->close();
-        return AcDbObjectId::kNull;
+    AcDbBlockReference* pBlockRef = nullptr;
+    acadInsertBlock(pBlockTable, pModelSpace, blockName, origin, pBlockRef);
+
+    AcDbObjectId blockRefId = pBlockRef ? pBlockRef->objectId() : AcDbObjectId::kNull;
+
+    // Clean up
+    acadCloseObject(pBlockRef);
+    acadCloseObject(pModelSpace);
+    acadCloseObject(pBlockTable);
+
+    return blockRefId;
+}
+
+Acad::ErrorStatus acadInsertBlock(
+    AcDbBlockTable* pBlockTable,
+    AcDbBlockTableRecord* pSpace,
+    const wchar_t* blockName,
+    const AcGePoint3d& origin,
+    AcDbBlockReference*& pBlockRef
+) {
+    pBlockRef = nullptr;
+
+    AcadBlockDefinition blockDef;
+    Acad::ErrorStatus es = acadGetBlockDefinition(pBlockTable, blockName, blockDef);
+    if (es != Acad::eOk) return es;
+
+    return acadInsertBlock(pSpace, blockDef, origin, pBlockRef);
+}
+
+Acad::ErrorStatus acadGetBlockDefinition(
+    AcDbBlockTable* pBlockTable,
+    const wchar_t* blockName,
+    AcadBlockDefinition& outDef
+) {
+    outDef.attributes.clear();
+
+    // Get the ObjectId of the block definition
+    Acad::ErrorStatus es = pBlockTable->getAt(blockName, outDef.id);
+    if (es != Acad::eOk || !outDef.id) {
+        acutPrintf(L"\nError: Block '%ls' not found in drawing.", blockName);
+        return (es != Acad::eOk) ? es : Acad::eKeyNotFound;
     }
 
     // Open the block definition for reading
     AcDbBlockTableRecord* pBlockDef = nullptr;
-    if (acdbOpenObject(pBlockDef, blockDefId, AcDb::kForRead) != Acad::eOk || !pBlockDef) {
+    es = acadOpenObject(pBlockDef, outDef.id, AcDb::kForRead);
+    if (es != Acad::eOk) {
         acutPrintf(L"\nError: Could not open block definition.");
-        pBlockRef->close();
-        pModelSpace->close();
-        pBlockTable->close();
-        return AcDbObjectId::kNull;
+        return es;
+    }
+
+    // Blocks without attributes need no templates
+    if (!pBlockDef->hasAttributeDefinitions()) {
+        acadCloseObject(pBlockDef);
+        return Acad::eOk;
     }
 
     // Create an iterator for the block definition entities
     AcDbBlockTableRecordIterator* pIter = nullptr;
-    if (pBlockDef->newIterator(pIter) != Acad::eOk) {
+    es = pBlockDef->newIterator(pIter);
+    if (es != Acad::eOk) {
         acutPrintf(L"\nError: Could not create iterator for block definition.");
-        pBlockDef->close();
-        pBlockRef->close();
-        pModelSpace->close();
-        pBlockTable->close();
-        return AcDbObjectId::kNull;
+        acadCloseObject(pBlockDef);
+        return es;
     }
 
     // Loop through the block definition to find attribute definitions
     for (; !pIter->done(); pIter->step()) {
-        AcDbEntity* pEnt = nullptr;
-        if (pIter->getEntity(pEnt, AcDb::kForRead) != Acad::eOk || !pEnt)
+        AcDbObjectId entId;
+        AcDbAttributeDefinition* pAttDef = nullptr;
+        if (pIter->getEntityId(entId) != Acad::eOk ||
+            acadOpenObject(pAttDef, entId, AcDb::kForRead) != Acad::eOk)
             continue;
 
-        AcDbAttributeDefinition* pAttDef = AcDbAttributeDefinition::cast(pEnt);
-        if (pAttDef && !pAttDef->isConstant()) {
-           // Create a new attribute based on the definition
-            AcDbAttribute* pAtt = new AcDbAttribute();
+        if (!pAttDef->isConstant()) {
+            // Create a template attribute based on the definition, in block coordinates
+            std::unique_ptr<AcDbAttribute> pAtt(new AcDbAttribute());
             pAtt->setPropertiesFrom(pAttDef);                               // Copy general properties
-
-            // Transform the attribute definition position into world space
-            AcGePoint3d localPos = pAttDef->position();
-            AcGePoint3d worldPos = pBlockRef->blockTransform() * localPos;
-            pAtt->setPosition(worldPos);                                    // Set transformed position
-
+            pAtt->setPosition(pAttDef->position());                         // Block coordinates
             pAtt->setJustification(pAttDef->justification());               // Match justification
-
-            AcGePoint3d localAlign = pAttDef->alignmentPoint();
-            AcGePoint3d worldAlign = pBlockRef->blockTransform() * localAlign;
-            pAtt->setAlignmentPoint(worldAlign);                            // This must happen after justification
-
+            pAtt->setAlignmentPoint(pAttDef->alignmentPoint());             // This must happen after justification
             pAtt->setHeight(pAttDef->height());                             // Match text height
             pAtt->setRotation(pAttDef->rotation());                         // Match rotation
             pAtt->setTag(pAttDef->tag());                                   // Match tag
@@ -116,22 +215,67 @@ AcDbObjectId acadInsertBlock(const wchar_t* blockName, const AcGePoint3d& origin
 
             pAtt->setTextString(pAttDef->textString());                     // Use default value
 
-            // Append the attribute to the block reference
-            pBlockRef->appendAttribute(pAtt);
-            pAtt->close();
+            outDef.attributes.push_back(std::move(pAtt));
         }
 
-        pEnt->close();
+        acadCloseObject(pAttDef);
     }
 
     // Clean up
     delete pIter;
-    pBlockDef->close();
-    pBlockRef->close();
-    pModelSpace->close();
-    pBlockTable->close();
+    acadCloseObject(pBlockDef);
 
-    return blockRefId;
+    return Acad::eOk;
+}
+
+Acad::ErrorStatus acadInsertBlock(
+    AcDbBlockTableRecord* pSpace,
+    const AcadBlockDefinition& blockDef,
+    const AcGePoint3d& origin,
+    AcDbBlockReference*& pBlockRef
+) {
+    pBlockRef = nullptr;
+
+    // Create a new block reference at the given origin
+    AcDbBlockReference* pNewRef = new AcDbBlockReference(origin, blockDef.id);
+
+    // Add the block reference to the block table record
+    AcDbObjectId blockRefId;
+    Acad::ErrorStatus es = pSpace->appendAcDbEntity(blockRefId, pNewRef);
+    if (es != Acad::eOk) {
+        acutPrintf(L"\nError: Failed to insert block reference.");
+        delete pNewRef;
+        return es;
+    }
+
+    // The new reference is open for writing, and is handed to the caller open
+    _openCounter.opens++;
+    if (_transactionDepth > 0) {
+        actrTransactionManager->addNewlyCreatedDBRObject(pNewRef);
+        _transactionOpens++;
+    }
+
+    // Clone every attribute template into world space
+    AcGeMatrix3d blockTransform = pNewRef->blockTransform();
+    for (const std::unique_ptr<AcDbAttribute>& pTemplate : blockDef.attributes) {
+        AcDbAttribute* pAtt = AcDbAttribute::cast(pTemplate->clone());
+        if (!pAtt) continue;
+
+        pAtt->setPosition(blockTransform * pTemplate->position());
+        pAtt->setAlignmentPoint(blockTransform * pTemplate->alignmentPoint());
+
+        // Append the attribute to the block reference
+        AcDbObjectId attId;
+        if (pNewRef->appendAttribute(attId, pAtt) == Acad::eOk) {
+            _openCounter.opens++;
+            _releaseNewObject(pAtt);
+        } else {
+            delete pAtt;
+        }
+    }
+
+    pBlockRef = pNewRef;
+    return Acad::eOk;
 }
 
 Acad::ErrorStatus acadSetDynBlockProperty(
@@ -141,12 +285,25 @@ Acad::ErrorStatus acadSetDynBlockProperty(
 ) {
     // Open block reference for writing
     AcDbBlockReference* pBlkRef = nullptr;
-    Acad::ErrorStatus es = acdbOpenObject(pBlkRef, blockRefId, AcDb::kForWrite);
-    if (es != Acad::eOk || !pBlkRef) {
+    Acad::ErrorStatus es = acadOpenObject(pBlkRef, blockRefId, AcDb::kForWrite);
+    if (es != Acad::eOk) {
         acutPrintf(L"\nError: Could not open block reference for writing.");
         return es;
     }
 
+    es = acadSetDynBlockProperty(pBlkRef, propName, newValue);
+
+    acadCloseObject(pBlkRef);
+    return es;
+}
+
+Acad::ErrorStatus acadSetDynBlockProperty(
+    AcDbBlockReference* pBlkRef,
+    const wchar_t* propName,
+    const AcDbEvalVariant& newValue
+) {
+    if (!pBlkRef) return Acad::eNullObjectPointer;
+
     // Get dynamic block properties
     AcDbDynBlockReference dynBlkRef(pBlkRef);
     AcDbDynBlockReferencePropertyArray propArray;
@@ -157,20 +314,15 @@ Acad::ErrorStatus acadSetDynBlockProperty(
         AcDbDynBlockReferenceProperty& prop = propArray[i];
 
         if (wcscmp(prop.propertyName(), propName) == 0) {
-            es = prop.setValue(newValue);
-            if (es == Acad::eOk) {
-                pBlkRef->close();
-                return Acad::eOk;
-            } else {
+            Acad::ErrorStatus es = prop.setValue(newValue);
+            if (es != Acad::eOk) {
                 acutPrintf(L"\nError: Failed to set value for property '%ls'.", propName);
-                pBlkRef->close();
-                return es;
             }
+            return es;
         }
     }
 
     acutPrintf(L"\nWarning: Property '%ls' not found.", propName);
-    pBlkRef->close();
     return Acad::eKeyNotFound;
 }
 
@@ -181,12 +333,25 @@ Acad::ErrorStatus acadGetDynBlockProperty(
 ) {
     // Open block reference for reading
     AcDbBlockReference* pBlkRef = nullptr;
-    Acad::ErrorStatus es = acdbOpenObject(pBlkRef, blockRefId, AcDb::kForRead);
-    if (es != Acad::eOk || !pBlkRef) {
+    Acad::ErrorStatus es = acadOpenObject(pBlkRef, blockRefId, AcDb::kForRead);
+    if (es != Acad::eOk) {
         acutPrintf(L"\nError: Could not open block reference for reading.");
         return es;
     }
 
+    es = acadGetDynBlockProperty(pBlkRef, propName, outValue);
+
+    acadCloseObject(pBlkRef);
+    return es;
+}
+
+Acad::ErrorStatus acadGetDynBlockProperty(
+    AcDbBlockReference* pBlkRef,
+    const wchar_t* propName,
+    AcDbEvalVariant& outValue
+) {
+    if (!pBlkRef) return Acad::eNullObjectPointer;
+
     // Get dynamic block properties
     AcDbDynBlockReference dynBlkRef(pBlkRef);
     AcDbDynBlockReferencePropertyArray propArray;
@@ -198,23 +363,86 @@ Acad::ErrorStatus acadGetDynBlockProperty(
 
         if (wcscmp(prop.propertyName(), propName) == 0) {
             outValue = prop.value();
-            pBlkRef->close();
-
-            if (es == Acad::eOk) {
-                return Acad::eOk;
-            } else {
-                acutPrintf(L"\nError: Failed to read value for property '%ls'.", propName);
-                return es;
-            }
+            return Acad::eOk;
         }
     }
 
     // Property not found
     acutPrintf(L"\nWarning: Property '%ls' not found.", propName);
-    pBlkRef->close();
     return Acad::eKeyNotFound;
 }
 
+Acad::ErrorStatus acadSetDynBlockProperties(
+    const AcDbObjectId& blockRefId,
+    const AcadDynPropertyList& values,
+    AcadDynPropertyCache* pCache
+) {
+    // Open block reference for writing
+    AcDbBlockReference* pBlkRef = nullptr;
+    Acad::ErrorStatus es = acadOpenObject(pBlkRef, blockRefId, AcDb::kForWrite);
+    if (es != Acad::eOk) {
+        acutPrintf(L"\nError: Could not open block reference for writing.");
+        return es;
+    }
+
+    es = acadSetDynBlockProperties(pBlkRef, values, pCache);
+
+    acadCloseObject(pBlkRef);
+    return es;
+}
+
+Acad::ErrorStatus acadSetDynBlockProperties(
+    AcDbBlockReference* pBlkRef,
+    const AcadDynPropertyList& values,
+    AcadDynPropertyCache* pCache
+) {
+    if (!pBlkRef) return Acad::eNullObjectPointer;
+
+    // Get dynamic block properties, once for every value
+    AcDbDynBlockReference dynBlkRef(pBlkRef);
+    AcDbDynBlockReferencePropertyArray propArray;
+    dynBlkRef.getBlockProperties(propArray);
+
+    AcadDynPropertyIndex* pIndex = pCache ? &(*pCache)[dynBlkRef.dynamicBlockTableRecord()] : nullptr;
+
+    Acad::ErrorStatus result = Acad::eOk;
+    for (const auto& value : values) {
+        const wchar_t* propName = value.first.c_str();
+
+        // Try the position this property had on the last reference of the block
+        int found = -1;
+        if (pIndex) {
+            auto it = pIndex->find(value.first);
+            if (it != pIndex->end() && it->second < propArray.length() &&
+                wcscmp(propArray[it->second].propertyName(), propName) == 0) {
+                found = it->second;
+            }
+        }
+
+        // Search for matching property
+        for (int i = 0; found < 0 && i < propArray.length(); ++i) {
+            if (wcscmp(propArray[i].propertyName(), propName) == 0) {
+                found = i;
+                if (pIndex) (*pIndex)[value.first] = i;
+            }
+        }
+
+        if (found < 0) {
+            acutPrintf(L"\nWarning: Property '%ls' not found.", propName);
+            if (result == Acad::eOk) result = Acad::eKeyNotFound;
+            continue;
+        }
+
+        Acad::ErrorStatus es = propArray[found].setValue(value.second);
+        if (es != Acad::eOk) {
+            acutPrintf(L"\nError: Failed to set value for property '%ls'.", propName);
+            if (result == Acad::eOk) result = es;
+        }
+    }
+
+    return result;
+}
+
 Acad::ErrorStatus acadSetBlockAttribute(
     const AcDbObjectId& blockRefId,
     const wchar_t* tagName,
@@ -222,17 +450,29 @@ Acad::ErrorStatus acadSetBlockAttribute(
 ) {
     // Open block reference for writing
     AcDbBlockReference* pBlkRef = nullptr;
-    Acad::ErrorStatus es = acdbOpenObject(pBlkRef, blockRefId, AcDb::kForWrite);
-    if (es != Acad::eOk || !pBlkRef) {
+    Acad::ErrorStatus es = acadOpenObject(pBlkRef, blockRefId, AcDb::kForWrite);
+    if (es != Acad::eOk) {
         acutPrintf(L"\nError: Could not open block reference.");
         return es;
     }
 
+    es = acadSetBlockAttribute(pBlkRef, tagName, newValue);
+
+    acadCloseObject(pBlkRef);
+    return es;
+}
+
+Acad::ErrorStatus acadSetBlockAttribute(
+    AcDbBlockReference* pBlkRef,
+    const wchar_t* tagName,
+    const wchar_t* newValue
+) {
+    if (!pBlkRef) return Acad::eNullObjectPointer;
+
     // Create iterator for attached attributes
     AcDbObjectIterator* pIter = pBlkRef->attributeIterator();
     if (!pIter) {
         acutPrintf(L"\nError: Failed to get attribute iterator.");
-        pBlkRef->close();
         return Acad::eNullIterator;
     }
 
@@ -241,22 +481,20 @@ Acad::ErrorStatus acadSetBlockAttribute(
         AcDbObjectId attId = pIter->objectId();
         AcDbAttribute* pAtt = nullptr;
 
-        if (acdbOpenObject(pAtt, attId, AcDb::kForWrite) == Acad::eOk && pAtt) {
+        if (acadOpenObject(pAtt, attId, AcDb::kForWrite) == Acad::eOk) {
             if (_wcsicmp(pAtt->tag(), tagName) == 0) {
                 pAtt->setTextString(newValue);
                 pAtt->adjustAlignment();
-                pAtt->close();
+                acadCloseObject(pAtt);
                 delete pIter;
-                pBlkRef->close();
                 return Acad::eOk;
             }
-            pAtt->close();
+            acadCloseObject(pAtt);
         }
     }
 
     // Not found
     delete pIter;
-    pBlkRef->close();
     acutPrintf(L"\nWarning: Attribute '%ls' not found.", tagName);
     return Acad::eKeyNotFound;
 }
@@ -268,17 +506,29 @@ Acad::ErrorStatus acadGetBlockAttribute(
 ) {
     // Open block reference for reading
     AcDbBlockReference* pBlkRef = nullptr;
-    Acad::ErrorStatus es = acdbOpenObject(pBlkRef, blockRefId, AcDb::kForRead);
-    if (es != Acad::eOk || !pBlkRef) {
+    Acad::ErrorStatus es = acadOpenObject(pBlkRef, blockRefId, AcDb::kForRead);
+    if (es != Acad::eOk) {
         acutPrintf(L"\nError: Could not open block reference.");
         return es;
     }
 
+    es = acadGetBlockAttribute(pBlkRef, tagName, outValue);
+
+    acadCloseObject(pBlkRef);
+    return es;
+}
+
+Acad::ErrorStatus acadGetBlockAttribute(
+    AcDbBlockReference* pBlkRef,
+    const wchar_t*      tagName,
+    std::wstring&       outValue
+) {
+    if (!pBlkRef) return Acad::eNullObjectPointer;
+
     // Create iterator for attached attributes
     AcDbObjectIterator* pIter = pBlkRef->attributeIterator();
     if (!pIter) {
         acutPrintf(L"\nError: Failed to get attribute iterator.");
-        pBlkRef->close();
         return Acad::eNullIterator;
     }
 
@@ -287,59 +537,165 @@ Acad::ErrorStatus acadGetBlockAttribute(
         AcDbObjectId attId = pIter->objectId();
         AcDbAttribute* pAtt = nullptr;
 
-        if (acdbOpenObject(pAtt, attId, AcDb::kForRead) == Acad::eOk && pAtt) {
+        if (acadOpenObject(pAtt, attId, AcDb::kForRead) == Acad::eOk) {
             if (_wcsicmp(pAtt->tag(), tagName) == 0) {
                 // Found – copy value to outValue
                 outValue = pAtt->textString();
-                pAtt->close();
+                acadCloseObject(pAtt);
                 delete pIter;
-                pBlkRef->close();
                 return Acad::eOk;
             }
-            pAtt->close();
+            acadCloseObject(pAtt);
         }
     }
 
     // Not found
     delete pIter;
-    pBlkRef->close();
     acutPrintf(L"\nWarning: Attribute '%ls' not found.", tagName);
     return Acad::eKeyNotFound;
 }
 
+Acad::ErrorStatus acadSetBlockAttributes(
+    const AcDbObjectId&     blockRefId,
+    const AcadAttributeMap& values
+) {
+    // Open block reference for reading, only the attributes are changed
+    AcDbBlockReference* pBlkRef = nullptr;
+    Acad::ErrorStatus es = acadOpenObject(pBlkRef, blockRefId, AcDb::kForRead);
+    if (es != Acad::eOk) {
+        acutPrintf(L"\nError: Could not open block reference.");
+        return es;
+    }
+
+    es = acadSetBlockAttributes(pBlkRef, values);
+
+    acadCloseObject(pBlkRef);
+    return es;
+}
+
+Acad::ErrorStatus acadSetBlockAttributes(
+    AcDbBlockReference*     pBlkRef,
+    const AcadAttributeMap& values
+) {
+    if (!pBlkRef) return Acad::eNullObjectPointer;
+
+    // Create iterator for attached attributes
+    AcDbObjectIterator* pIter = pBlkRef->attributeIterator();
+    if (!pIter) {
+        acutPrintf(L"\nError: Failed to get attribute iterator.");
+        return Acad::eNullIterator;
+    }
+
+    // Visit every attribute once, updating the ones with a new value
+    size_t updated = 0;
+    for (; !pIter->done() && updated < values.size(); pIter->step()) {
+        AcDbAttribute* pAtt = nullptr;
+        if (acadOpenObject(pAtt, pIter->objectId(), AcDb::kForRead) != Acad::eOk) continue;
+
+        auto it = values.find(pAtt->tag());
+        if (it != values.end() && pAtt->upgradeOpen() == Acad::eOk) {
+            pAtt->setTextString(it->second.c_str());
+            pAtt->adjustAlignment();
+            updated++;
+        }
+
+        acadCloseObject(pAtt);
+    }
+
+    delete pIter;
+
+    if (updated < values.size()) {
+        acutPrintf(L"\nWarning: %d of %d attributes not found.", (int)(values.size() - updated), (int)values.size());
+        return Acad::eKeyNotFound;
+    }
+
+    return Acad::eOk;
+}
+
+Acad::ErrorStatus acadGetBlockAttributes(
+    const AcDbObjectId& blockRefId,
+    AcadAttributeMap&   outValues
+) {
+    // Open block reference for reading
+    AcDbBlockReference* pBlkRef = nullptr;
+    Acad::ErrorStatus es = acadOpenObject(pBlkRef, blockRefId, AcDb::kForRead);
+    if (es != Acad::eOk) {
+        acutPrintf(L"\nError: Could not open block reference.");
+        return es;
+    }
+
+    es = acadGetBlockAttributes(pBlkRef, outValues);
+
+    acadCloseObject(pBlkRef);
+    return es;
+}
+
+Acad::ErrorStatus acadGetBlockAttributes(
+    AcDbBlockReference* pBlkRef,
+    AcadAttributeMap&   outValues
+) {
+    if (!pBlkRef) return Acad::eNullObjectPointer;
+
+    outValues.clear();
+
+    // Create iterator for attached attributes
+    AcDbObjectIterator* pIter = pBlkRef->attributeIterator();
+    if (!pIter) {
+        acutPrintf(L"\nError: Failed to get attribute iterator.");
+        return Acad::eNullIterator;
+    }
+
+    for (; !pIter->done(); pIter->step()) {
+        AcDbAttribute* pAtt = nullptr;
+        if (acadOpenObject(pAtt, pIter->objectId(), AcDb::kForRead) != Acad::eOk) continue;
+
+        outValues[pAtt->tag()] = pAtt->textString();
+
+        acadCloseObject(pAtt);
+    }
+
+    delete pIter;
+    return Acad::eOk;
+}
+
 Acad::ErrorStatus acadSetObjectProperty(
     const AcDbObjectId& objId,
     AcDb::DxfCode groupCode,
     const wchar_t* value
 ) {
     AcDbEntity* pEnt = nullptr;
-    Acad::ErrorStatus es = acdbOpenObject(pEnt, objId, AcDb::kForWrite);
-    if (es != Acad::eOk || !pEnt) {
+    Acad::ErrorStatus es = acadOpenObject(pEnt, objId, AcDb::kForWrite);
+    if (es != Acad::eOk) {
         acutPrintf(L"\nError: Unable to open entity for writing.");
         return es;
     }
 
+    es = acadSetObjectProperty(pEnt, groupCode, value);
+
+    acadCloseObject(pEnt);
+    return es;
+}
+
+Acad::ErrorStatus acadSetObjectProperty(
+    AcDbEntity* pEnt,
+    AcDb::DxfCode groupCode,
+    const wchar_t* value
+) {
+    if (!pEnt) return Acad::eNullObjectPointer;
+
     switch (groupCode) {
         case AcDb::kDxfLayerName:
-            es = pEnt->setLayer(value);
-            break;
+            return pEnt->setLayer(value);
         case AcDb::kDxfLinetypeName:
-            es = pEnt->setLinetype(value);
-            break;
+            return pEnt->setLinetype(value);
         case AcDb::kDxfLinetypeScale:
-            es = pEnt->setLinetypeScale(wcstod(value, nullptr));
-            break;
+            return pEnt->setLinetypeScale(wcstod(value, nullptr));
         case AcDb::kDxfColor:
-            es = pEnt->setColorIndex(_wtoi(value));
-            break;
+            return pEnt->setColorIndex(_wtoi(value));
         default:
             acutPrintf(L"\nError: Unsupported DXF code %d", groupCode);
-            es = Acad::eNotImplementedYet;
-            break;
+            return Acad::eNotImplementedYet;
     }
-
-    pEnt->close();
-    return es;
 }
 
 Acad::ErrorStatus acadSetObjectPosition(
@@ -347,12 +703,24 @@ Acad::ErrorStatus acadSetObjectPosition(
     const AcGePoint3d& position
 ) {
     AcDbEntity* pEnt = nullptr;
-    Acad::ErrorStatus es = acdbOpenObject(pEnt, objId, AcDb::kForWrite);
-    if (es != Acad::eOk || !pEnt) {
+    Acad::ErrorStatus es = acadOpenObject(pEnt, objId, AcDb::kForWrite);
+    if (es != Acad::eOk) {
         acutPrintf(L"\nError: Could not open object for writing.");
         return es;
     }
 
+    es = acadSetObjectPosition(pEnt, position);
+
+    acadCloseObject(pEnt);
+    return es;
+}
+
+Acad::ErrorStatus acadSetObjectPosition(
+    AcDbEntity* pEnt,
+    const AcGePoint3d& position
+) {
+    if (!pEnt) return Acad::eNullObjectPointer;
+
     if (pEnt->isKindOf(AcDbBlockReference::desc())) {
         AcDbBlockReference* pBlkRef = AcDbBlockReference::cast(pEnt);
 
@@ -385,11 +753,9 @@ Acad::ErrorStatus acadSetObjectPosition(
     }
     else {
         acutPrintf(L"\nError: Unsupported entity type for setting position.");
-        pEnt->close();
         return Acad::eInvalidInput;
     }
 
-    pEnt->close();
     return Acad::eOk;
 }
 
@@ -398,12 +764,24 @@ Acad::ErrorStatus acadGetObjectPosition(
     AcGePoint3d& outPosition
 ) {
     AcDbEntity* pEnt = nullptr;
-    Acad::ErrorStatus es = acdbOpenObject(pEnt, objId, AcDb::kForRead);
-    if (es != Acad::eOk || !pEnt) {
+    Acad::ErrorStatus es = acadOpenObject(pEnt, objId, AcDb::kForRead);
+    if (es != Acad::eOk) {
         acutPrintf(L"\nError: Could not open object for reading.");
         return es;
     }
 
+    es = acadGetObjectPosition(pEnt, outPosition);
+
+    acadCloseObject(pEnt);
+    return es;
+}
+
+Acad::ErrorStatus acadGetObjectPosition(
+    AcDbEntity* pEnt,
+    AcGePoint3d& outPosition
+) {
+    if (!pEnt) return Acad::eNullObjectPointer;
+
     if (pEnt->isKindOf(AcDbBlockReference::desc())) {
         AcDbBlockReference* pBlockRef = AcDbBlockReference::cast(pEnt);
         outPosition = pBlockRef->position();
@@ -426,11 +804,9 @@ Acad::ErrorStatus acadGetObjectPosition(
     }
     else {
         acutPrintf(L"\nError: Unsupported entity type for position extraction.");
-        pEnt->close();
         return Acad::eInvalidInput;
     }
 
-    pEnt->close();
     return Acad::eOk;
 }
 
@@ -439,24 +815,31 @@ Acad::ErrorStatus acadSetObjectScale(
     const AcGeScale3d& scale
 ) {
     AcDbEntity* pEnt = nullptr;
-    Acad::ErrorStatus es = acdbOpenObject(pEnt, objId, AcDb::kForWrite);
-    if (es != Acad::eOk || !pEnt) {
+    Acad::ErrorStatus es = acadOpenObject(pEnt, objId, AcDb::kForWrite);
+    if (es != Acad::eOk) {
         acutPrintf(L"\nError: Could not open object for writing.");
         return es;
     }
 
+    es = acadSetObjectScale(pEnt, scale);
+
+    acadCloseObject(pEnt);
+    return es;
+}
+
+Acad::ErrorStatus acadSetObjectScale(
+    AcDbEntity* pEnt,
+    const AcGeScale3d& scale
+) {
+    if (!pEnt) return Acad::eNullObjectPointer;
+
     if (pEnt->isKindOf(AcDbBlockReference::desc())) {
         AcDbBlockReference* pBlkRef = AcDbBlockReference::cast(pEnt);
-        pBlkRef->setScaleFactors(scale);
-    }
-    else {
-        acutPrintf(L"\nError: Unsupported entity type for setting scale.");
-        pEnt->close();
-        return Acad::eInvalidInput;
+        return pBlkRef->setScaleFactors(scale);
     }
 
-    pEnt->close();
-    return Acad::eOk;
+    acutPrintf(L"\nError: Unsupported entity type for setting scale.");
+    return Acad::eInvalidInput;
 }
 
 Acad::ErrorStatus acadGetObjectScale(
@@ -464,24 +847,32 @@ Acad::ErrorStatus acadGetObjectScale(
     AcGeScale3d& outScale
 ) {
     AcDbEntity* pEnt = nullptr;
-    Acad::ErrorStatus es = acdbOpenObject(pEnt, objId, AcDb::kForRead);
-    if (es != Acad::eOk || !pEnt) {
+    Acad::ErrorStatus es = acadOpenObject(pEnt, objId, AcDb::kForRead);
+    if (es != Acad::eOk) {
         acutPrintf(L"\nError: Could not open object for reading.");
         return es;
     }
 
+    es = acadGetObjectScale(pEnt, outScale);
+
+    acadCloseObject(pEnt);
+    return es;
+}
+
+Acad::ErrorStatus acadGetObjectScale(
+    AcDbEntity* pEnt,
+    AcGeScale3d& outScale
+) {
+    if (!pEnt) return Acad::eNullObjectPointer;
+
     if (pEnt->isKindOf(AcDbBlockReference::desc())) {
         AcDbBlockReference* pBlkRef = AcDbBlockReference::cast(pEnt);
         outScale = pBlkRef->scaleFactors();
-    }
-    else {
-        acutPrintf(L"\nError: Unsupported entity type for reading scale.");
-        pEnt->close();
-        return Acad::eInvalidInput;
+        return Acad::eOk;
     }
 
-    pEnt->close();
-    return Acad::eOk;
+    acutPrintf(L"\nError: Unsupported entity type for reading scale.");
+    return Acad::eInvalidInput;
 }
 
 Acad::ErrorStatus acadGetBlockName(
@@ -489,27 +880,36 @@ Acad::ErrorStatus acadGetBlockName(
     std::wstring &name
 ) {
     AcDbEntity *pEnt = nullptr;
-    Acad::ErrorStatus es = acdbOpenObject(pEnt, objId, AcDb::kForRead);
-    if (es != Acad::eOk || !pEnt) {
+    Acad::ErrorStatus es = acadOpenObject(pEnt, objId, AcDb::kForRead);
+    if (es != Acad::eOk) {
         acutPrintf(L"\nError: Unable to open entity for reading.");
         return es;
     }
 
     if (!pEnt->isKindOf(AcDbBlockReference::desc())) {
         name = L"";
-        pEnt->close();
+        acadCloseObject(pEnt);
         return Acad::eOk;
     }
 
-    AcDbBlockReference *pBlockRef = AcDbBlockReference::cast(pEnt);
+    es = acadGetBlockName(AcDbBlockReference::cast(pEnt), name);
+
+    acadCloseObject(pEnt);
+    return es;
+}
+
+Acad::ErrorStatus acadGetBlockName(
+    AcDbBlockReference* pBlockRef,
+    std::wstring &name
+) {
+    if (!pBlockRef) return Acad::eNullObjectPointer;
 
     AcDbObjectId blockDefId = pBlockRef->blockTableRecord();
 
     AcDbBlockTableRecord *pBlockDef = nullptr;
-    es = acdbOpenObject(pBlockDef, blockDefId, AcDb::kForRead);
-    if (es != Acad::eOk || !pBlockDef) {
+    Acad::ErrorStatus es = acadOpenObject(pBlockDef, blockDefId, AcDb::kForRead);
+    if (es != Acad::eOk) {
         acutPrintf(L"\nError: Unable to open block definition for reading.");
-        pEnt->close();
         return es;
     }
 
@@ -518,33 +918,109 @@ Acad::ErrorStatus acadGetBlockName(
 
     // Check if this is an anonymous block (name starts with *)
     if (blockName[0] != '*') {
-        pBlockDef->close();
-        pEnt->close();
-
         name = blockName;
 
+        acadCloseObject(pBlockDef);
+
         return Acad::eOk;
     }
 
-    AcDbDynBlockReference dynBlkDefRef(objId);
+    AcDbDynBlockReference dynBlkDefRef(pBlockRef);
     AcDbObjectId dynBlkDefId = dynBlkDefRef.dynamicBlockTableRecord();
 
     AcDbBlockTableRecord *pDynBlockDef = nullptr;
-    es = acdbOpenObject(pDynBlockDef, dynBlkDefId, AcDb::kForRead);
+    es = acadOpenObject(pDynBlockDef, dynBlkDefId, AcDb::kForRead);
 
-    if (es != Acad::eOk || !pDynBlockDef) {
+    if (es != Acad::eOk) {
         acutPrintf(L"\nError: Unable to open dynamic block reference for reading.");
+        acadCloseObject(pBlockDef);
         return es;
     }
 
     const ACHAR* dynName = nullptr;
     pDynBlockDef->getName(dynName);
 
-    pDynBlockDef->close();
-    pBlockDef->close();
-    pEnt->close();
-
     name = dynName;
 
+    acadCloseObject(pDynBlockDef);
+    acadCloseObject(pBlockDef);
+
     return Acad::eOk;
-}
\ No newline at end of file
+}
+
+Acad::ErrorStatus acadOpenNamedDictionary(
+    AcDbDatabase* pDb,
+    const ACHAR* name,
+    AcDbDictionary*& pDict,
+    AcDb::OpenMode mode,
+    bool create
+) {
+    pDict = nullptr;
+    if (!pDb) return Acad::eNullObjectPointer;
+
+    AcDbDictionary* pNamedObjects = nullptr;
+    Acad::ErrorStatus es = acadOpenObject(pNamedObjects, pDb->namedObjectsDictionaryId(), AcDb::kForRead);
+    if (es != Acad::eOk) {
+        acutPrintf(L"\nError: Could not access the named objects dictionary.");
+        return es;
+    }
+
+    AcDbObjectId dictId;
+    if (pNamedObjects->getAt(name, dictId) != Acad::eOk) {
+        if (!create) {
+            acadCloseObject(pNamedObjects);
+            return Acad::eKeyNotFound;
+        }
+
+        es = pNamedObjects->upgradeOpen();
+        if (es == Acad::eOk) es = acadAddDictionaryObject(pNamedObjects, name, new AcDbDictionary(), dictId);
+
+        if (es != Acad::eOk) {
+            acadCloseObject(pNamedObjects);
+            return es;
+        }
+    }
+
+    acadCloseObject(pNamedObjects);
+
+    return acadOpenObject(pDict, dictId, mode);
+}
+
+Acad::ErrorStatus acadAddDictionaryObject(
+    AcDbDictionary* pDict,
+    const ACHAR* key,
+    AcDbObject* pObj,
+    AcDbObjectId& objId
+) {
+    if (!pDict || !pObj) {
+        delete pObj;
+        return Acad::eNullObjectPointer;
+    }
+
+    Acad::ErrorStatus es = pDict->setAt(key, pObj, objId);
+    if (es != Acad::eOk) {
+        delete pObj;
+        return es;
+    }
+
+    // The new object is open for writing until it is released
+    _openCounter.opens++;
+    _releaseNewObject(pObj);
+
+    return Acad::eOk;
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static void _releaseNewObject(AcDbObject* pObj) {
+    if (_transactionDepth > 0) {
+        actrTransactionManager->addNewlyCreatedDBRObject(pObj);
+        _transactionOpens++;
+        return;
+    }
+
+    pObj->close();
+    _openCounter.closes++;
+}
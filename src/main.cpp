@@ -41,8 +41,14 @@ void initApp() {
     acedRegCmds->addCommand(L"GSTCH_WIRING_COMMANDS", L"GSTCH_BUILDJUNCTION", L"BUILDJUNCTION", ACRX_CMD_MODAL, buildJunctionBox);
     acedRegCmds->addCommand(L"GSTCH_WIRING_COMMANDS", L"GSTCH_FLIPCABLE", L"FLIPCABLE", ACRX_CMD_MODAL | ACRX_CMD_USEPICKSET | ACRX_CMD_REDRAW, flipCable);
     acedRegCmds->addCommand(L"GSTCH_WIRING_COMMANDS", L"GSTCH_REINDEXCABLE", L"REINDEXCABLE", ACRX_CMD_MODAL | ACRX_CMD_USEPICKSET | ACRX_CMD_REDRAW, reIndexCable);
+    acedRegCmds->addCommand(L"GSTCH_WIRING_COMMANDS", L"GSTCH_REINDEXALL", L"REINDEXALL", ACRX_CMD_MODAL | ACRX_CMD_REDRAW, reIndexAll);
+    acedRegCmds->addCommand(L"GSTCH_WIRING_COMMANDS", L"GSTCH_AUTOREINDEX", L"AUTOREINDEX", ACRX_CMD_MODAL, autoReindex);
+    acedRegCmds->addCommand(L"GSTCH_WIRING_COMMANDS", L"GSTCH_EXPORTTERMINALS", L"EXPORTTERMINALS", ACRX_CMD_MODAL, exportTerminals);
+    acedRegCmds->addCommand(L"GSTCH_WIRING_COMMANDS", L"GSTCH_VERIFYDRAWING", L"VERIFYDRAWING", ACRX_CMD_MODAL, verifyDrawing);
+    acedRegCmds->addCommand(L"GSTCH_WIRING_COMMANDS", L"GSTCH_OPENCOUNTS", L"OPENCOUNTS", ACRX_CMD_MODAL, openCounts);
 }
 
 void unloadApp() {
+    stopCableMoveWatcher();
     acedRegCmds->removeGroup(L"GSTCH_WIRING_COMMANDS");
 }
\ No newline at end of file
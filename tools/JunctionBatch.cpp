@@ -0,0 +1,577 @@
+/**
+ * @file JunctionBatch.cpp
+ * @brief Command-line tool that plans every junction box of a project.
+ *
+ * Usage:
+ *
+ *     JunctionBatch [-j threads] [-o directory] [-c catalog.txt] [-s auto|small|medium|large|custom|<enclosure>] <workbook.xlsx>...
+ *
+ * Every workbook is parsed and every junction in it is planned on a pool of
+ * worker threads (`-j`, all cores by default). For each junction two files are
+ * written to `<directory>/<workbook name>/`:
+ *
+ *  - `<tag>.json`, the box size and the placement of every cable, and
+ *  - `<tag>.csv`, the terminal schedule: one row per device terminal with its
+ *    table, terminal, cable, device and wire, as EXPORTTERMINALS writes them
+ *    once the box is drawn.
+ *
+ * `<directory>/summary.json` lists every junction with its box size, terminal
+ * counts and any error. With `-s auto` (the default) each junction gets the
+ * smallest standard box it fits in, or a custom box if it fits in none.
+ *
+ * `-c` loads an enclosure catalog (see `BoxCatalog`). `-s` can then name one
+ * of its enclosures, and `-s auto` tries the catalog enclosures, in the order
+ * they are listed, for a junction that fits in no standard box.
+ *
+ * Results are collected by junction rather than by thread, so the output is
+ * identical for any number of threads. Throughput is reported on standard
+ * output only. The exit code is 1 if any workbook or junction failed.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BoxCatalog.h"
+#include "Cable.h"
+#include "Drawing.h"
+#include "LayoutPlanner.h"
+#include "TerminalTable.h"
+#include "Workbook.h"
+
+// -----------------------------------------------------------------------------
+// Internal Constants
+// -----------------------------------------------------------------------------
+
+static const char* const _cableTypeNames[] = { "PAIR1", "PAIR2", "PAIR4", "TRIAD1", "WIRE7" };
+static const char* const _systemTypeNames[] = { "CONTROL", "SAFETY" };
+static const char* const _ioTypeNames[] = { "ANALOG", "DIGITAL" };
+
+// -----------------------------------------------------------------------------
+// Internal Types
+// -----------------------------------------------------------------------------
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief A workbook named on the command line.
+ */
+struct _WorkbookInput {
+    std::string filename;                       ///< Path as given on the command line.
+    std::filesystem::path directory;            ///< Output directory of its junctions.
+    std::shared_ptr<const Workbook> workbook;   ///< The parsed workbook, or nullptr if it failed.
+    std::string error;                          ///< Why the workbook failed, empty otherwise.
+};
+
+/**
+ * @brief The box every junction is planned in, from `-s` and `-c`.
+ */
+struct _BoxOptions {
+    BoxSize boxSize = BoxSize::CUSTOM;  ///< Standard size, CUSTOM for a custom box or a catalog enclosure.
+    bool autoSize = true;               ///< true to pick the box each junction fits in.
+    int enclosure = -1;                 ///< Index of the catalog enclosure named with `-s`, or -1.
+    std::vector<Enclosure> catalog;     ///< Enclosures of the catalog given with `-c`.
+};
+
+/**
+ * @brief A junction to plan, and the outcome once it is planned.
+ */
+struct _BoxTask {
+    size_t workbook;        ///< Index of the workbook in the inputs.
+    std::string tag;        ///< Junction tag.
+    std::string fileName;   ///< Name of its output files, without extension.
+    std::string boxName;    ///< Name of the box size used.
+    size_t cables = 0;      ///< Number of cables.
+    int footprint = 0;      ///< Terminals used by the cables.
+    int spare = 0;          ///< Unused terminals, or 0 for a custom box.
+    int overflowIndex = -1; ///< First cable that runs off its table, or -1.
+    std::string error;      ///< Why the junction failed, empty otherwise.
+};
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Call `work` once for every index below `count` on up to `threads` threads.
+ *
+ * Indices are handed out in order as threads become free. `work` must not throw.
+ */
+static void _runPool(size_t count, unsigned threads, const std::function<void(size_t)>& work);
+
+/**
+ * @brief Parse a box size argument.
+ *
+ * @param text    The argument.
+ * @param options Receives the size, or the catalog enclosure it names.
+ * @return        true if `text` names a box size or catalog enclosure, false otherwise.
+ */
+static bool _parseBoxSize(const std::string& text, _BoxOptions& options);
+
+/**
+ * @brief Plan one junction and write its plan and terminal schedule.
+ */
+static void _planBox(_BoxTask& task, const _WorkbookInput& input, const _BoxOptions& options);
+
+/**
+ * @brief Write the project summary.
+ */
+static void _writeSummary(const std::filesystem::path& filename, const std::vector<_WorkbookInput>& inputs, const std::vector<_BoxTask>& tasks);
+
+/**
+ * @brief Write a whole file at once.
+ *
+ * @throws std::runtime_error if the file cannot be written.
+ */
+static void _writeFile(const std::filesystem::path& filename, const std::string& text);
+
+/**
+ * @brief Quote and escape a string for JSON.
+ */
+static std::string _json(const std::string& text);
+
+/**
+ * @brief Quote a string for CSV if it needs it.
+ */
+static std::string _csv(const std::string& text);
+
+/**
+ * @brief Convert drawing text to ASCII, writing anything else as '?'.
+ */
+static std::string _narrow(const std::wstring& text);
+
+/**
+ * @brief Format a coordinate with four decimals.
+ */
+static std::string _number(double value);
+
+/**
+ * @brief Make a junction tag or workbook name safe to use as a file name.
+ */
+static std::string _fileName(const std::string& text);
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    std::filesystem::path outputDirectory = "junctions";
+    std::string sizeName = "auto";
+    std::string catalogFile;
+
+    std::vector<_WorkbookInput> inputs;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+
+        if ((arg == "-j" || arg == "-o" || arg == "-s" || arg == "-c") && i + 1 >= argc) {
+            std::fprintf(stderr, "Missing value for %s\n", arg.c_str());
+            return 2;
+        }
+
+        if (arg == "-j") {
+            int count = std::atoi(argv[++i]);
+            if (count < 1) {
+                std::fprintf(stderr, "Thread count must be at least 1\n");
+                return 2;
+            }
+            threads = static_cast<unsigned>(count);
+        } else if (arg == "-o") {
+            outputDirectory = argv[++i];
+        } else if (arg == "-s") {
+            sizeName = argv[++i];
+        } else if (arg == "-c") {
+            catalogFile = argv[++i];
+        } else {
+            _WorkbookInput input;
+            input.filename = arg;
+            inputs.push_back(input);
+        }
+    }
+
+    if (inputs.empty()) {
+        std::fprintf(stderr, "Usage: %s [-j threads] [-o directory] [-c catalog.txt] [-s auto|small|medium|large|custom|<enclosure>] <workbook.xlsx>...\n", argv[0]);
+        return 2;
+    }
+
+    // The catalog is loaded first so -s can name one of its enclosures
+    _BoxOptions options;
+    if (!catalogFile.empty()) {
+        try {
+            options.catalog = BoxCatalog::open(catalogFile).getEnclosures();
+        } catch (const std::exception& e) {
+            std::fprintf(stderr, "%s\n", e.what());
+            return 1;
+        }
+    }
+
+    if (!_parseBoxSize(sizeName, options)) {
+        std::fprintf(stderr, "Unknown box size: %s\n", sizeName.c_str());
+        return 2;
+    }
+
+    Clock::time_point start = Clock::now();
+
+    // Parse the workbooks
+    _runPool(inputs.size(), threads, [&](size_t i) {
+        try {
+            inputs[i].workbook = Workbook::open(inputs[i].filename);
+        } catch (const std::exception& e) {
+            inputs[i].error = e.what();
+        }
+    });
+
+    double parseSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    // Give each workbook its own directory and collect every junction, in
+    // workbook order and then in the order each junction first appears
+    std::vector<_BoxTask> tasks;
+    std::set<std::string> directories;
+
+    try {
+        for (size_t w = 0; w < inputs.size(); ++w) {
+            std::string name = _fileName(std::filesystem::path(inputs[w].filename).stem().string());
+
+            std::string unique = name;
+            for (int n = 2; !directories.insert(unique).second; ++n) unique = name + "-" + std::to_string(n);
+
+            inputs[w].directory = outputDirectory / unique;
+
+            if (!inputs[w].workbook) continue;
+
+            std::filesystem::create_directories(inputs[w].directory);
+
+            // Tags that only differ in characters a file name cannot hold must
+            // still get files of their own
+            std::set<std::string> fileNames;
+
+            for (const std::string& tag : inputs[w].workbook->getJunctionTags()) {
+                _BoxTask task;
+                task.workbook = w;
+                task.tag = tag;
+
+                std::string fileName = _fileName(tag);
+                task.fileName = fileName;
+                for (int n = 2; !fileNames.insert(task.fileName).second; ++n) task.fileName = fileName + "-" + std::to_string(n);
+
+                tasks.push_back(task);
+            }
+        }
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+
+    // Plan every junction. Each task only writes its own result and files.
+    Clock::time_point planStart = Clock::now();
+
+    _runPool(tasks.size(), threads, [&](size_t i) {
+        try {
+            _planBox(tasks[i], inputs[tasks[i].workbook], options);
+        } catch (const std::exception& e) {
+            tasks[i].error = e.what();
+        }
+    });
+
+    double planSeconds = std::chrono::duration<double>(Clock::now() - planStart).count();
+
+    try {
+        _writeSummary(outputDirectory / "summary.json", inputs, tasks);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+
+    size_t failures = 0;
+    for (const _WorkbookInput& input : inputs) {
+        if (input.error.empty()) continue;
+        std::fprintf(stderr, "%s: %s\n", input.filename.c_str(), input.error.c_str());
+        failures++;
+    }
+    for (const _BoxTask& task : tasks) {
+        if (task.error.empty()) continue;
+        std::fprintf(stderr, "%s: %s: %s\n", inputs[task.workbook].filename.c_str(), task.tag.c_str(), task.error.c_str());
+        failures++;
+    }
+
+    double totalSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::printf("Planned %zu boxes from %zu workbooks on %u threads, %zu failed\n", tasks.size(), inputs.size(), threads, failures);
+    std::printf("Parsing %.3f s, planning %.3f s (%.0f boxes/s), total %.3f s (%.0f boxes/s)\n",
+        parseSeconds, planSeconds, tasks.size() / std::max(planSeconds, 1e-9),
+        totalSeconds, tasks.size() / std::max(totalSeconds, 1e-9));
+
+    return failures == 0 ? 0 : 1;
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static void _runPool(size_t count, unsigned threads, const std::function<void(size_t)>& work) {
+    std::atomic<size_t> next(0);
+
+    auto worker = [&]() {
+        for (size_t i = next++; i < count; i = next++) work(i);
+    };
+
+    std::vector<std::thread> pool;
+    size_t poolSize = std::min<size_t>(threads, count);
+    for (size_t t = 1; t < poolSize; ++t) pool.emplace_back(worker);
+
+    // The calling thread works too
+    worker();
+
+    for (std::thread& thread : pool) thread.join();
+}
+
+static bool _parseBoxSize(const std::string& text, _BoxOptions& options) {
+    options.autoSize = false;
+    options.boxSize = BoxSize::CUSTOM;
+    options.enclosure = -1;
+
+    if (text == "auto") options.autoSize = true;
+    else if (text == "small") options.boxSize = BoxSize::SMALL;
+    else if (text == "medium") options.boxSize = BoxSize::MEDIUM;
+    else if (text == "large") options.boxSize = BoxSize::LARGE;
+    else if (text == "custom") options.boxSize = BoxSize::CUSTOM;
+    else {
+        for (size_t e = 0; e < options.catalog.size() && options.enclosure < 0; ++e) {
+            if (options.catalog[e].name == text) options.enclosure = static_cast<int>(e);
+        }
+        return options.enclosure >= 0;
+    }
+
+    return true;
+}
+
+static void _planBox(_BoxTask& task, const _WorkbookInput& input, const _BoxOptions& options) {
+    std::vector<Cable> cables = input.workbook->getCables(task.tag);
+
+    std::sort(cables.begin(), cables.end());
+
+    std::vector<BoxFit> fits = FitEvaluator::evaluate(cables);
+    std::vector<BoxFit> enclosureFits = FitEvaluator::evaluate(cables, options.catalog);
+
+    BoxSize boxSize = options.boxSize;
+    int enclosure = options.enclosure;
+
+    // Pick the smallest standard box the cables fit in, then the first
+    // catalog enclosure
+    if (options.autoSize) {
+        boxSize = BoxSize::CUSTOM;
+        for (const BoxFit& fit : fits) {
+            if (fit.spare >= 0) {
+                boxSize = fit.boxSize;
+                break;
+            }
+        }
+
+        for (size_t e = 0; boxSize == BoxSize::CUSTOM && enclosure < 0 && e < enclosureFits.size(); ++e) {
+            if (enclosureFits[e].spare >= 0) enclosure = static_cast<int>(e);
+        }
+    }
+
+    const BoxFit* fit = nullptr;
+    if (enclosure >= 0) fit = &enclosureFits[enclosure];
+    else if (boxSize != BoxSize::CUSTOM) fit = &fits[boxSize];
+
+    LayoutPlan plan = (enclosure >= 0) ? LayoutPlanner(options.catalog[enclosure]).plan(cables) : LayoutPlanner(boxSize).plan(cables);
+
+    task.boxName = fit ? fit->name : "custom";
+    task.cables = cables.size();
+    task.footprint = plan.getFootprint();
+    task.spare = fit ? fit->spare : 0;
+    task.overflowIndex = plan.getOverflowIndex();
+
+    std::string json;
+    json += "{\n";
+    json += "  \"junction\": " + _json(task.tag) + ",\n";
+    json += "  \"box\": " + _json(task.boxName) + ",\n";
+    json += "  \"footprint\": " + std::to_string(task.footprint) + ",\n";
+    json += "  \"spare\": " + std::to_string(task.spare) + ",\n";
+    json += "  \"overflowIndex\": " + std::to_string(task.overflowIndex) + ",\n";
+    json += "  \"cables\": [";
+
+    std::string schedule = "Junction,Table,Terminal,Cable,Device,Wire\n";
+    for (const TerminalRow& row : getTerminalRows(cables, plan, std::wstring(task.tag.begin(), task.tag.end()))) {
+        schedule += _csv(task.tag) + "," + std::to_string(row.table) + "," + std::to_string(row.terminal) + ","
+                  + _csv(_narrow(row.cableLabel)) + "," + _csv(_narrow(row.deviceTag)) + "," + _csv(_narrow(row.wire)) + "\n";
+    }
+
+    for (size_t i = 0; i < cables.size(); ++i) {
+        const Cable& cable = cables[i];
+        const CablePlacement& placement = plan[i];
+        std::string label = _narrow(getCableLabel(cable));
+
+        json += (i == 0) ? "\n" : ",\n";
+        json += "    {\n";
+        json += "      \"label\": " + _json(label) + ",\n";
+        json += "      \"type\": \"" + std::string(_cableTypeNames[cable.getCableType()]) + "\",\n";
+        json += "      \"system\": \"" + std::string(_systemTypeNames[cable.getSystemType()]) + "\",\n";
+        json += "      \"io\": \"" + std::string(_ioTypeNames[cable.getIOType()]) + "\",\n";
+        json += "      \"table\": " + std::to_string(placement.table) + ",\n";
+        json += "      \"terminal\": " + std::to_string(placement.terminal) + ",\n";
+        json += "      \"flip\": " + std::string(placement.flip ? "true" : "false") + ",\n";
+        json += "      \"x\": " + _number(placement.origin.x) + ",\n";
+        json += "      \"y\": " + _number(placement.origin.y) + ",\n";
+        json += "      \"devices\": [";
+
+        std::vector<Device> devices = cable.getDevices();
+        for (size_t d = 0; d < devices.size(); ++d) {
+            if (d != 0) json += ", ";
+            json += _json(devices[d].getCombinedTag());
+        }
+
+        json += "]\n    }";
+    }
+
+    json += cables.empty() ? "]\n}\n" : "\n  ]\n}\n";
+
+    _writeFile(input.directory / (task.fileName + ".json"), json);
+    _writeFile(input.directory / (task.fileName + ".csv"), schedule);
+}
+
+static void _writeSummary(const std::filesystem::path& filename, const std::vector<_WorkbookInput>& inputs, const std::vector<_BoxTask>& tasks) {
+    size_t failed = 0;
+    size_t cables = 0;
+    for (const _BoxTask& task : tasks) {
+        if (!task.error.empty()) failed++;
+        cables += task.cables;
+    }
+
+    std::string json;
+    json += "{\n";
+    json += "  \"boxes\": " + std::to_string(tasks.size()) + ",\n";
+    json += "  \"failed\": " + std::to_string(failed) + ",\n";
+    json += "  \"cables\": " + std::to_string(cables) + ",\n";
+    json += "  \"workbooks\": [";
+
+    size_t t = 0;
+    for (size_t w = 0; w < inputs.size(); ++w) {
+        const _WorkbookInput& input = inputs[w];
+
+        json += (w == 0) ? "\n" : ",\n";
+        json += "    {\n";
+        json += "      \"file\": " + _json(input.filename) + ",\n";
+        json += "      \"directory\": " + _json(input.directory.filename().string()) + ",\n";
+        if (!input.error.empty()) json += "      \"error\": " + _json(input.error) + ",\n";
+        json += "      \"junctions\": [";
+
+        bool first = true;
+        for (; t < tasks.size() && tasks[t].workbook == w; ++t) {
+            const _BoxTask& task = tasks[t];
+
+            json += first ? "\n" : ",\n";
+            first = false;
+
+            json += "        { \"tag\": " + _json(task.tag) + ", \"file\": " + _json(task.fileName);
+            if (task.error.empty()) {
+                json += ", \"box\": " + _json(task.boxName);
+                json += ", \"cables\": " + std::to_string(task.cables);
+                json += ", \"footprint\": " + std::to_string(task.footprint);
+                json += ", \"spare\": " + std::to_string(task.spare);
+                json += ", \"overflowIndex\": " + std::to_string(task.overflowIndex);
+            } else {
+                json += ", \"error\": " + _json(task.error);
+            }
+            json += " }";
+        }
+
+        json += first ? "]\n    }" : "\n      ]\n    }";
+    }
+
+    json += inputs.empty() ? "]\n}\n" : "\n  ]\n}\n";
+
+    _writeFile(filename, json);
+}
+
+static void _writeFile(const std::filesystem::path& filename, const std::string& text) {
+    std::ofstream file(filename, std::ios::binary);
+    file.write(text.data(), text.size());
+
+    if (!file) {
+        throw std::runtime_error("Failed to write " + filename.string());
+    }
+}
+
+static std::string _json(const std::string& text) {
+    std::string quoted = "\"";
+    for (char c : text) {
+        switch (c)
+        {
+        case '"' :  quoted += "\\\""; break;
+        case '\\' : quoted += "\\\\"; break;
+        case '\n' : quoted += "\\n"; break;
+        case '\r' : quoted += "\\r"; break;
+        case '\t' : quoted += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char escape[8];
+                std::snprintf(escape, sizeof(escape), "\\u%04x", c);
+                quoted += escape;
+            } else {
+                quoted += c;
+            }
+            break;
+        }
+    }
+    return quoted + "\"";
+}
+
+static std::string _csv(const std::string& text) {
+    if (text.find_first_of(",\"\n") == std::string::npos) return text;
+
+    std::string quoted = "\"";
+    for (char c : text) {
+        if (c == '"') quoted += '"';
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+static std::string _narrow(const std::wstring& text) {
+    std::string narrow;
+    narrow.reserve(text.size());
+    for (wchar_t c : text) narrow += (static_cast<unsigned long>(c) < 128) ? static_cast<char>(c) : '?';
+    return narrow;
+}
+
+static std::string _number(double value) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.4f", value);
+    if (std::string(buffer) == "-0.0000") return "0.0000";
+    return buffer;
+}
+
+static std::string _fileName(const std::string& text) {
+    std::string name = text;
+    for (char& c : name) {
+        bool safe = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-' || c == '_' || c == '.' || c == ' ';
+        if (!safe) c = '_';
+    }
+    if (name.empty() || name == "." || name == "..") return "_";
+    return name;
+}
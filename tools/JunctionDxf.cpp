@@ -0,0 +1,216 @@
+/**
+ * @file JunctionDxf.cpp
+ * @brief Command-line tool that writes junction box diagrams to a DXF file.
+ *
+ * Usage:
+ *
+ *     JunctionDxf [-b blocks.dxf] [-c catalog.txt] <workbook.xlsx> <output.dxf> [junction tag] [small|medium|large|custom|<enclosure>]
+ *
+ * Without a junction tag every junction in the workbook is written as a
+ * custom box, side by side, exactly as BUILDJUNCTION's "Select All" draws
+ * them. With a tag only that junction is written, for the given box size
+ * (custom if omitted). The size can also name an enclosure of the catalog
+ * given with `-c` (see `BoxCatalog`). Pass `-` as the output to write to
+ * standard output.
+ *
+ * Attributes are placed by the attribute definitions of the block library
+ * given with `-b`, a DXF saved from the drawing template. Without it no
+ * attribute is written, so the file only holds the block references, and a
+ * warning is printed.
+ *
+ * Boxes are drawn and written one at a time, so memory use does not grow with
+ * the number of boxes. A junction whose rows are not compatible is reported
+ * and skipped; the exit code is then 1.
+ *
+ * This module is part of the Junction Diagram Automation Suite. Unauthorized
+ * copying, distribution, or modification is prohibited.
+ *
+ * @version 1.2.0
+ * @author Ethan Barnes <ebarnes@gastecheng.com>
+ * @date 2026-10-16
+ * @copyright Proprietary - All Rights Reserved by GasTech Engineering LLC
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "BoxCatalog.h"
+#include "Cable.h"
+#include "DrawBuffer.h"
+#include "Drawing.h"
+#include "DxfBackend.h"
+#include "LayoutPlanner.h"
+#include "Workbook.h"
+
+// -----------------------------------------------------------------------------
+// Forward Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Parse a box size argument.
+ *
+ * @return true if `text` names a box size, false otherwise.
+ */
+static bool _parseBoxSize(const std::string& text, BoxSize& boxSize);
+
+// -----------------------------------------------------------------------------
+// Function Definitions
+// -----------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    const char* program = argv[0];
+
+    std::string library;
+    std::string catalogFile;
+    while (argc >= 3 && (std::string(argv[1]) == "-b" || std::string(argv[1]) == "-c")) {
+        if (std::string(argv[1]) == "-b") library = argv[2];
+        else catalogFile = argv[2];
+        argc -= 2;
+        argv += 2;
+    }
+
+    if (argc < 3 || argc > 5) {
+        std::fprintf(stderr, "Usage: %s [-b blocks.dxf] [-c catalog.txt] <workbook.xlsx> <output.dxf> [junction tag] [small|medium|large|custom|<enclosure>]\n", program);
+        std::fprintf(stderr, "Without -b no attributes are written; they are placed by the attribute definitions of the block library.\n");
+        return 2;
+    }
+
+    std::string filename = argv[1];
+    std::string output = argv[2];
+
+    if (library.empty()) {
+        std::fprintf(stderr, "Warning: no block library given with -b, so no attributes are written\n");
+    }
+
+    BoxCatalog catalog;
+    if (!catalogFile.empty()) {
+        try {
+            catalog = BoxCatalog::open(catalogFile);
+        } catch (const std::exception& e) {
+            std::fprintf(stderr, "%s\n", e.what());
+            return 1;
+        }
+    }
+
+    BoxSize boxSize = BoxSize::CUSTOM;
+    const Enclosure* enclosure = nullptr;
+    if (argc == 5 && !_parseBoxSize(argv[4], boxSize)) {
+        enclosure = catalog.find(argv[4]);
+        if (!enclosure) {
+            std::fprintf(stderr, "Unknown box size: %s\n", argv[4]);
+            return 2;
+        }
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    DxfBlockTemplates templates;
+    if (!library.empty()) {
+        std::ifstream in(library, std::ios::binary);
+        if (!in) {
+            std::fprintf(stderr, "Failed to open %s\n", library.c_str());
+            return 1;
+        }
+
+        try {
+            templates = readDxfBlockTemplates(in);
+        } catch (const std::exception& e) {
+            std::fprintf(stderr, "%s: %s\n", library.c_str(), e.what());
+            return 1;
+        }
+    }
+
+    std::shared_ptr<const Workbook> workbook;
+    try {
+        workbook = Workbook::open(filename);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+
+    std::vector<std::string> junctionTags;
+    if (argc >= 4) {
+        junctionTags.push_back(argv[3]);
+    } else {
+        junctionTags = workbook->getJunctionTags();
+    }
+
+    std::ofstream file;
+    if (output != "-") {
+        file.open(output, std::ios::binary);
+        if (!file) {
+            std::fprintf(stderr, "Failed to open %s for writing\n", output.c_str());
+            return 1;
+        }
+    }
+
+    DxfBackend backend(output == "-" ? std::cout : file, getDrawingBlockNames(), std::move(templates));
+
+    // One buffer is reused for every box, so only the box being written is in memory
+    DrawBuffer buffer;
+
+    int failures = 0;
+    size_t cableCount = 0;
+    size_t blockCount = 0;
+
+    for (size_t i = 0; i < junctionTags.size(); ++i) {
+        std::vector<Cable> cables;
+        try {
+            cables = workbook->getCables(junctionTags[i]);
+        } catch (const std::exception& e) {
+            std::fprintf(stderr, "%s: %s\n", junctionTags[i].c_str(), e.what());
+            failures++;
+            continue;
+        }
+
+        std::sort(cables.begin(), cables.end());
+
+        // Boxes are placed side by side as BUILDJUNCTION places them
+        LayoutPoint origin = { (argc >= 4) ? 0.0 : -11.0 * i, 0.0 };
+        LayoutPlan plan = enclosure ? LayoutPlanner(*enclosure).plan(cables) : LayoutPlanner(boxSize, origin).plan(cables);
+
+        if (plan.overflows()) {
+            std::fprintf(stderr, "%s: cables do not fit in the box, the extra cables run off the table\n", junctionTags[i].c_str());
+        }
+
+        std::wstring junctionTag(junctionTags[i].begin(), junctionTags[i].end());
+
+        buffer.clear();
+        drawJunctionBox(buffer, cables, plan, junctionTag);
+        backend.execute(buffer);
+
+        cableCount += cables.size();
+        blockCount += buffer.getBlockCount();
+    }
+
+    backend.finish();
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::fprintf(stderr, "Wrote %zu boxes, %zu cables and %zu blocks in %.3f s\n",
+        junctionTags.size() - failures, cableCount, blockCount, seconds);
+
+    return failures == 0 ? 0 : 1;
+}
+
+// -----------------------------------------------------------------------------
+// Helper Function Definitions
+// -----------------------------------------------------------------------------
+
+static bool _parseBoxSize(const std::string& text, BoxSize& boxSize) {
+    if (text == "small") boxSize = BoxSize::SMALL;
+    else if (text == "medium") boxSize = BoxSize::MEDIUM;
+    else if (text == "large") boxSize = BoxSize::LARGE;
+    else if (text == "custom") boxSize = BoxSize::CUSTOM;
+    else return false;
+
+    return true;
+}